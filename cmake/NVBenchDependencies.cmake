@@ -70,6 +70,20 @@ else()
   )
 endif()
 
+################################################################################
+# Threads: host-side parallel statistics, and the host backend's streams.
+rapids_find_package(Threads REQUIRED
+  BUILD_EXPORT_SET nvbench-targets
+  INSTALL_EXPORT_SET nvbench-targets
+)
+
+if (NVBENCH_HAS_HOST_BACKEND)
+  ##############################################################################
+  # Host backend: the simulated device runs streams on worker threads.
+  set(ctk_libraries Threads::Threads)
+  return()
+endif()
+
 ################################################################################
 # CUDAToolkit
 rapids_find_package(HIP REQUIRED
@@ -82,5 +96,5 @@ set(ctk_libraries hip::host)
 ################################################################################
 # Libhipcxx
 include("${CMAKE_CURRENT_LIST_DIR}/NVBenchLibhipcxx.cmake")
-list(APPEND ctk_libraries libhipcxx::libhipcxx hip::host)
+list(APPEND ctk_libraries libhipcxx::libhipcxx hip::host Threads::Threads)
 ################################################################################
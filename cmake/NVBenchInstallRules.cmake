@@ -24,8 +24,16 @@ install(DIRECTORY "${NVBench_SOURCE_DIR}/nvbench"
   FILES_MATCHING
     PATTERN "*.cuh"
     PATTERN "internal" EXCLUDE
+    PATTERN "host_backend" EXCLUDE
 )
 
+# simulated device runtime headers:
+if (NVBENCH_HAS_HOST_BACKEND)
+  install(DIRECTORY "${NVBench_SOURCE_DIR}/nvbench/host_backend/hip"
+    DESTINATION "${CMAKE_INSTALL_INCLUDEDIR}/nvbench/host_backend"
+  )
+endif()
+
 # generated headers from build dir:
 install(
   FILES
@@ -54,7 +54,9 @@ macro(nvbench_load_rapids_cmake)
   include(rapids-export)
   include(rapids-find)
 
-  rapids_hip_init_architectures(NVBench)
+  if (NOT NVBench_BACKEND STREQUAL "HOST")
+    rapids_hip_init_architectures(NVBench)
+  endif()
 endmacro()
 
 # Called after project(...)
@@ -77,6 +77,22 @@ struct axes_metadata
 
   void add_string_axis(std::string name, std::vector<std::string> data);
 
+  /// Iterate the named axes in lockstep, as a single dimension of the
+  /// parameter space, instead of over their cartesian product. The axes must
+  /// exist, must not be type axes or already zipped, and must have the same
+  /// number of values.
+  void zip_axes(std::vector<std::string> names);
+
+  /// Groups of axes passed to `zip_axes`.
+  [[nodiscard]] const std::vector<std::vector<std::string>> &get_zipped_axes() const
+  {
+    return m_zipped_axes;
+  }
+
+  /// Returns the group of zipped axes containing `name`, or nullptr if the
+  /// axis isn't zipped.
+  [[nodiscard]] const std::vector<std::string> *get_zip_group(std::string_view name) const;
+
   [[nodiscard]] const nvbench::int64_axis &get_int64_axis(std::string_view name) const;
   [[nodiscard]] nvbench::int64_axis &get_int64_axis(std::string_view name);
 
@@ -107,6 +123,7 @@ struct axes_metadata
 
 private:
   axes_type m_axes;
+  std::vector<std::vector<std::string>> m_zipped_axes;
 };
 
 template <typename... TypeAxes>
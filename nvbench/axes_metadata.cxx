@@ -49,6 +49,7 @@ namespace nvbench
 {
 
 axes_metadata::axes_metadata(const axes_metadata &other)
+    : m_zipped_axes{other.m_zipped_axes}
 {
   m_axes.reserve(other.get_axes().size());
   for (const auto &axis : other.get_axes())
@@ -65,6 +66,7 @@ axes_metadata &axes_metadata::operator=(const axes_metadata &other)
   {
     m_axes.push_back(axis->clone());
   }
+  m_zipped_axes = other.m_zipped_axes;
   return *this;
 }
 
@@ -121,6 +123,60 @@ void axes_metadata::add_string_axis(std::string name, std::vector<std::string> d
   m_axes.push_back(std::move(axis));
 }
 
+void axes_metadata::zip_axes(std::vector<std::string> names)
+try
+{
+  if (names.size() < 2)
+  {
+    NVBENCH_THROW(std::runtime_error, "{}", "At least two axes are required.");
+  }
+
+  const std::size_t size = this->get_axis(names.front()).get_size();
+  for (auto iter = names.cbegin(); iter != names.cend(); ++iter)
+  {
+    const auto &axis = this->get_axis(*iter);
+    if (axis.get_type() == nvbench::axis_type::type)
+    {
+      NVBENCH_THROW(std::runtime_error, "Type axis '{}' cannot be zipped.", *iter);
+    }
+    if (std::find(names.cbegin(), iter, *iter) != iter)
+    {
+      NVBENCH_THROW(std::runtime_error, "Axis '{}' is listed more than once.", *iter);
+    }
+    if (this->get_zip_group(*iter) != nullptr)
+    {
+      NVBENCH_THROW(std::runtime_error, "Axis '{}' is already zipped.", *iter);
+    }
+    if (axis.get_size() != size)
+    {
+      NVBENCH_THROW(std::runtime_error,
+                    "Axis '{}' has {} values, but '{}' has {}.",
+                    *iter,
+                    axis.get_size(),
+                    names.front(),
+                    size);
+    }
+  }
+
+  m_zipped_axes.push_back(std::move(names));
+}
+catch (std::exception &e)
+{
+  NVBENCH_THROW(std::runtime_error,
+                "Error in zip_axes:\n{}\n"
+                "Axes: {}",
+                e.what(),
+                names);
+}
+
+const std::vector<std::string> *axes_metadata::get_zip_group(std::string_view name) const
+{
+  auto iter = std::find_if(m_zipped_axes.cbegin(), m_zipped_axes.cend(), [&name](const auto &group) {
+    return std::find(group.cbegin(), group.cend(), name) != group.cend();
+  });
+  return iter == m_zipped_axes.cend() ? nullptr : &*iter;
+}
+
 const int64_axis &axes_metadata::get_int64_axis(std::string_view name) const
 {
   const auto &axis = this->get_axis(name, nvbench::axis_type::int64);
@@ -93,9 +93,14 @@ private:
   void do_run() final
   {
     nvbench::runner<benchmark> runner{*this};
-    runner.generate_states();
     runner.run();
   }
+
+  void do_run_isolated_worker(int fd) final
+  {
+    nvbench::runner<benchmark> runner{*this};
+    runner.run_isolated_worker(fd);
+  }
 };
 
 } // namespace nvbench
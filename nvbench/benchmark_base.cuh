@@ -40,16 +40,28 @@
 #include <nvbench/axes_metadata.cuh>
 #include <nvbench/device_info.cuh>
 #include <nvbench/device_manager.cuh>
+#include <nvbench/named_values.cuh>
+#include <nvbench/outlier_policy.cuh>
+#include <nvbench/sampling.cuh>
+#include <nvbench/sharding.cuh>
 #include <nvbench/state.cuh>
 
-#include <functional> // reference_wrapper, ref
+#include <functional> // function, reference_wrapper, ref
 #include <memory>
 #include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace nvbench
 {
 
+namespace detail
+{
+struct budget_scheduler;
+struct checkpoint_journal;
+} // namespace detail
+
 struct printer_base;
 struct runner_base;
 
@@ -126,6 +138,78 @@ struct benchmark_base
     return *this;
   }
 
+  /// Iterate the named axes in lockstep rather than over their cartesian
+  /// product, e.g. to benchmark `M`, `N`, `K` shapes taken from a trace.
+  /// The axes must have the same number of values.
+  benchmark_base &zip_axes(std::vector<std::string> names)
+  {
+    m_axes.zip_axes(std::move(names));
+    return *this;
+  }
+
+  /// Predicate over a configuration's axis values; see `add_constraint`.
+  using constraint_type = std::function<bool(const nvbench::named_values &)>;
+
+  /// Only run configurations for which `constraint` returns true, e.g. to
+  /// prune invalid combinations like `BlockSize > Elements`. Constraints are
+  /// checked as states are generated, so pruned configurations never allocate
+  /// a state and are not counted by `get_config_count()`. @{
+  benchmark_base &add_constraint(constraint_type constraint)
+  {
+    m_constraints.push_back(std::move(constraint));
+    return *this;
+  }
+  [[nodiscard]] const std::vector<constraint_type> &get_constraints() const
+  {
+    return m_constraints;
+  }
+  /// @}
+
+  /// Only run a sampled subset of the benchmark's configurations. See
+  /// `nvbench::sample_method`. Default is `sample_method::none`. @{
+  [[nodiscard]] const nvbench::sample_spec &get_sample_spec() const { return m_sample_spec; }
+  benchmark_base &set_sample_spec(nvbench::sample_spec spec)
+  {
+    m_sample_spec = spec;
+    return *this;
+  }
+  /// @}
+
+  /// Only run the configurations assigned to one shard, so that several
+  /// processes can split a benchmark between them. See `nvbench::shard_spec`.
+  /// Default is a single shard, which runs everything. @{
+  [[nodiscard]] const nvbench::shard_spec &get_shard() const { return m_shard; }
+  benchmark_base &set_shard(nvbench::shard_spec shard)
+  {
+    m_shard = shard;
+    return *this;
+  }
+  /// @}
+
+  /// Estimated configuration costs, e.g. from `nvbench::read_shard_costs`.
+  /// When set, configurations are assigned to shards to balance their total
+  /// cost rather than by hash. Every shard must use the same costs. @{
+  [[nodiscard]] const std::shared_ptr<const nvbench::shard_cost_map> &get_shard_costs() const
+  {
+    return m_shard_costs;
+  }
+  benchmark_base &set_shard_costs(std::shared_ptr<const nvbench::shard_cost_map> costs)
+  {
+    m_shard_costs = std::move(costs);
+    return *this;
+  }
+  /// @}
+
+  /// Seed used to draw the configuration sample. The same seed always selects
+  /// the same configurations. Default is 0. @{
+  [[nodiscard]] nvbench::int64_t get_sample_seed() const { return m_sample_seed; }
+  benchmark_base &set_sample_seed(nvbench::int64_t seed)
+  {
+    m_sample_seed = seed;
+    return *this;
+  }
+  /// @}
+
   benchmark_base &set_devices(std::vector<int> device_ids);
 
   benchmark_base &set_devices(std::vector<nvbench::device_info> devices)
@@ -154,16 +238,21 @@ struct benchmark_base
 
   [[nodiscard]] const nvbench::axes_metadata &get_axes() const { return m_axes; }
 
-  // Computes the number of configs in the benchmark.
+  // Computes the number of configs in the benchmark, after sampling.
   // Unlike get_states().size(), this method may be used prior to calling run().
   [[nodiscard]] std::size_t get_config_count() const;
 
-  // Is empty until run() is called.
+  // Is empty until run() is called. States are appended as they are
+  // generated and executed by run().
   [[nodiscard]] const std::vector<nvbench::state> &get_states() const { return m_states; }
   [[nodiscard]] std::vector<nvbench::state> &get_states() { return m_states; }
 
   void run() { this->do_run(); }
 
+  /// Runs the states requested over `fd` by the process that started this
+  /// one as an `--isolate` worker. See `nvbench::detail::worker_process`.
+  void run_isolated_worker(int fd) { this->do_run_isolated_worker(fd); }
+
   void set_printer(nvbench::printer_base &printer) { m_printer = std::ref(printer); }
 
   void clear_printer() { m_printer = std::nullopt; }
@@ -200,6 +289,86 @@ struct benchmark_base
   }
   /// @}
 
+  /// If true, percentiles are estimated with constant-memory streaming
+  /// sketches instead of retaining every sample. Individual sample times are
+  /// not recorded in this mode. Intended for very long runs. @{
+  [[nodiscard]] bool get_streaming_percentiles() const { return m_streaming_percentiles; }
+  benchmark_base &set_streaming_percentiles(bool v)
+  {
+    m_streaming_percentiles = v;
+    return *this;
+  }
+  /// @}
+
+  /// If true, the timer overheads measured by
+  /// `device_manager::get_timer_calibration` are subtracted from each cold and
+  /// CPU-only sample. Intended for very short kernels. @{
+  [[nodiscard]] bool get_subtract_timer_overhead() const { return m_subtract_timer_overhead; }
+  benchmark_base &set_subtract_timer_overhead(bool v)
+  {
+    m_subtract_timer_overhead = v;
+    return *this;
+  }
+  /// @}
+
+  /// If true, `run()` executes each device's states on its own thread, so all
+  /// devices are measured concurrently. Results are kept in the same order as
+  /// a sequential run. @{
+  [[nodiscard]] bool get_parallel_devices() const { return m_parallel_devices; }
+  benchmark_base &set_parallel_devices(bool v)
+  {
+    m_parallel_devices = v;
+    return *this;
+  }
+  /// @}
+
+  /// If true, `run()` executes the states in a separate worker process, so a
+  /// state that crashes or hangs is skipped instead of ending the run. The
+  /// worker is started with `get_isolate_args()`, which `option_parser` sets
+  /// to the current command line. Only supported on Linux. @{
+  [[nodiscard]] bool get_isolate() const { return m_isolate; }
+  benchmark_base &set_isolate(bool v)
+  {
+    m_isolate = v;
+    return *this;
+  }
+  [[nodiscard]] const std::vector<std::string> &get_isolate_args() const { return m_isolate_args; }
+  benchmark_base &set_isolate_args(std::vector<std::string> args)
+  {
+    m_isolate_args = std::move(args);
+    return *this;
+  }
+  /// @}
+
+  /// Spreads a walltime budget over the states of a run, overriding their
+  /// timeouts. Shared by every benchmark of the run; see `--time-budget`. @{
+  [[nodiscard]] const std::shared_ptr<nvbench::detail::budget_scheduler> &
+  get_budget_scheduler() const
+  {
+    return m_budget_scheduler;
+  }
+  benchmark_base &set_budget_scheduler(std::shared_ptr<nvbench::detail::budget_scheduler> scheduler)
+  {
+    m_budget_scheduler = std::move(scheduler);
+    return *this;
+  }
+  /// @}
+
+  /// Records each completed state, and restores the states recorded by an
+  /// interrupted run instead of running them again. Shared by every benchmark
+  /// of the run; see `--checkpoint` and `--resume`. @{
+  [[nodiscard]] const std::shared_ptr<nvbench::detail::checkpoint_journal> &
+  get_checkpoint_journal() const
+  {
+    return m_checkpoint_journal;
+  }
+  benchmark_base &set_checkpoint_journal(std::shared_ptr<nvbench::detail::checkpoint_journal> journal)
+  {
+    m_checkpoint_journal = std::move(journal);
+    return *this;
+  }
+  /// @}
+
   /// Accumulate at least this many seconds of timing data per measurement. @{
   [[nodiscard]] nvbench::float64_t get_min_time() const { return m_min_time; }
   benchmark_base &set_min_time(nvbench::float64_t min_time)
@@ -220,6 +389,38 @@ struct benchmark_base
   }
   /// @}
 
+  /// If positive, cold measurements stop once the half-width of the 95%
+  /// bootstrap confidence interval of the mean GPU time drops below this
+  /// fraction of the mean. This replaces the `max_noise` criteria.
+  /// Default value is -1., which disables the feature. @{
+  [[nodiscard]] nvbench::float64_t get_max_ci_half_width() const { return m_max_ci_half_width; }
+  benchmark_base &set_max_ci_half_width(nvbench::float64_t max_ci_half_width)
+  {
+    m_max_ci_half_width = max_ci_half_width;
+    return *this;
+  }
+  /// @}
+
+  /// Policy used to reject outlier samples from cold measurements. See
+  /// `nvbench::outlier_policy`. Default is `outlier_policy::none`. @{
+  [[nodiscard]] nvbench::outlier_policy get_outlier_policy() const { return m_outlier_policy; }
+  benchmark_base &set_outlier_policy(nvbench::outlier_policy policy)
+  {
+    m_outlier_policy = policy;
+    return *this;
+  }
+  /// @}
+
+  /// Rejection threshold for the outlier policy, in units of the policy's
+  /// spread estimate (scaled MAD or IQR). Default is 3. @{
+  [[nodiscard]] nvbench::float64_t get_outlier_threshold() const { return m_outlier_threshold; }
+  benchmark_base &set_outlier_threshold(nvbench::float64_t threshold)
+  {
+    m_outlier_threshold = threshold;
+    return *this;
+  }
+  /// @}
+
   /// If a warmup run finishes in less than `skip_time`, the measurement will
   /// be skipped.
   /// Extremely fast kernels (< 5000 ns) often timeout before they can
@@ -260,14 +461,31 @@ protected:
   std::vector<nvbench::device_info> m_devices;
   std::vector<nvbench::state> m_states;
 
+  std::vector<constraint_type> m_constraints;
+  nvbench::sample_spec m_sample_spec;
+  nvbench::int64_t m_sample_seed{0};
+  nvbench::shard_spec m_shard;
+  std::shared_ptr<const nvbench::shard_cost_map> m_shard_costs;
+  std::shared_ptr<nvbench::detail::budget_scheduler> m_budget_scheduler;
+  std::shared_ptr<nvbench::detail::checkpoint_journal> m_checkpoint_journal;
+
   optional_ref<nvbench::printer_base> m_printer;
 
   bool m_run_once{false};
   bool m_disable_blocking_kernel{false};
+  bool m_streaming_percentiles{false};
+  bool m_subtract_timer_overhead{false};
+  bool m_parallel_devices{false};
+  bool m_isolate{false};
+  std::vector<std::string> m_isolate_args;
 
   nvbench::int64_t m_min_samples{10};
   nvbench::float64_t m_min_time{0.5};
   nvbench::float64_t m_max_noise{0.005}; // 0.5% relative standard deviation
+  nvbench::float64_t m_max_ci_half_width{-1.};
+
+  nvbench::outlier_policy m_outlier_policy{nvbench::outlier_policy::none};
+  nvbench::float64_t m_outlier_threshold{3.};
 
   nvbench::float64_t m_skip_time{-1.};
   nvbench::float64_t m_timeout{15.};
@@ -277,6 +495,7 @@ private:
   virtual std::unique_ptr<benchmark_base> do_clone() const            = 0;
   virtual void do_set_type_axes_names(std::vector<std::string> names) = 0;
   virtual void do_run()                                               = 0;
+  virtual void do_run_isolated_worker(int fd)                         = 0;
 };
 
 } // namespace nvbench
@@ -37,8 +37,11 @@
 
 #include <nvbench/benchmark_base.cuh>
 
+#include <nvbench/detail/state_generator.cuh>
 #include <nvbench/detail/transform_reduce.cuh>
 
+#include <algorithm>
+
 namespace nvbench
 {
 
@@ -53,10 +56,30 @@ std::unique_ptr<benchmark_base> benchmark_base::clone() const
   result->m_axes    = m_axes;
   result->m_devices = m_devices;
 
+  result->m_constraints = m_constraints;
+  result->m_sample_spec = m_sample_spec;
+  result->m_sample_seed = m_sample_seed;
+  result->m_shard       = m_shard;
+  result->m_shard_costs = m_shard_costs;
+
+  result->m_budget_scheduler   = m_budget_scheduler;
+  result->m_checkpoint_journal = m_checkpoint_journal;
+
+  result->m_streaming_percentiles   = m_streaming_percentiles;
+  result->m_subtract_timer_overhead = m_subtract_timer_overhead;
+  result->m_parallel_devices        = m_parallel_devices;
+  result->m_isolate                 = m_isolate;
+  result->m_isolate_args            = m_isolate_args;
+
   result->m_min_samples = m_min_samples;
   result->m_min_time    = m_min_time;
   result->m_max_noise   = m_max_noise;
 
+  result->m_max_ci_half_width = m_max_ci_half_width;
+
+  result->m_outlier_policy    = m_outlier_policy;
+  result->m_outlier_threshold = m_outlier_threshold;
+
   result->m_skip_time = m_skip_time;
   result->m_timeout   = m_timeout;
 
@@ -81,21 +104,34 @@ benchmark_base &benchmark_base::add_device(int device_id)
 
 std::size_t benchmark_base::get_config_count() const
 {
+  const std::size_t num_devices = std::max(m_devices.size(), std::size_t{1});
+  if (m_sample_spec.is_enabled() || !m_constraints.empty() || m_shard.is_enabled())
+  {
+    return nvbench::detail::state_generator::count_states(*this) * num_devices;
+  }
+
   const std::size_t per_device_count = nvbench::detail::transform_reduce(
     m_axes.get_axes().cbegin(),
     m_axes.get_axes().cend(),
     std::size_t{1},
     std::multiplies<>{},
-    [](const auto &axis_ptr) {
+    [&axes = m_axes](const auto &axis_ptr) {
       if (const auto *type_axis_ptr = dynamic_cast<const nvbench::type_axis *>(axis_ptr.get());
           type_axis_ptr != nullptr)
       {
         return type_axis_ptr->get_active_count();
       }
+      // Zipped axes are a single dimension; only count the first of them:
+      if (const auto *zip_group = axes.get_zip_group(axis_ptr->get_name());
+          zip_group != nullptr && zip_group->front() != axis_ptr->get_name())
+      {
+        return std::size_t{1};
+      }
       return axis_ptr->get_size();
     });
 
-  return per_device_count * m_devices.size();
+  // Device-less benchmarks still run a single pass over their configs:
+  return per_device_count * num_devices;
 }
 
 } // namespace nvbench
@@ -37,38 +37,58 @@
 
 #pragma once
 
+#include <nvbench/config.cuh>
 #include <nvbench/types.cuh>
 
-#include <chrono>
+#include <nvbench/detail/cpu_clock.cuh>
 
 namespace nvbench
 {
 
-struct cpu_timer
+/**
+ * Host wall-clock timer. `Clock` is one of the clocks in
+ * `nvbench/detail/cpu_clock.cuh`; see the `cpu_timer` alias below for the
+ * default.
+ */
+template <typename Clock>
+struct basic_cpu_timer
 {
-  __forceinline__ cpu_timer() = default;
+  using clock_type = Clock;
+
+  __forceinline__ basic_cpu_timer() = default;
 
   // move-only
-  cpu_timer(const cpu_timer &)            = delete;
-  cpu_timer(cpu_timer &&)                 = default;
-  cpu_timer &operator=(const cpu_timer &) = delete;
-  cpu_timer &operator=(cpu_timer &&)      = default;
+  basic_cpu_timer(const basic_cpu_timer &)            = delete;
+  basic_cpu_timer(basic_cpu_timer &&)                 = default;
+  basic_cpu_timer &operator=(const basic_cpu_timer &) = delete;
+  basic_cpu_timer &operator=(basic_cpu_timer &&)      = default;
 
-  __forceinline__ void start() { m_start = std::chrono::high_resolution_clock::now(); }
+  __forceinline__ void start() { m_start = Clock::start(); }
 
-  __forceinline__ void stop() { m_stop = std::chrono::high_resolution_clock::now(); }
+  __forceinline__ void stop() { m_stop = Clock::stop(); }
 
   // In seconds:
   [[nodiscard]] __forceinline__ nvbench::float64_t get_duration()
   {
-    const auto duration = m_stop - m_start;
-    const auto ns       = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
-    return static_cast<nvbench::float64_t>(ns) * (1e-9);
+    return Clock::to_seconds(m_stop - m_start);
   }
 
 private:
-  std::chrono::high_resolution_clock::time_point m_start;
-  std::chrono::high_resolution_clock::time_point m_stop;
+  typename Clock::tick_type m_start{};
+  typename Clock::tick_type m_stop{};
 };
 
+using chrono_cpu_timer        = basic_cpu_timer<detail::chrono_clock>;
+using monotonic_raw_cpu_timer = basic_cpu_timer<detail::monotonic_raw_clock>;
+using tsc_cpu_timer           = basic_cpu_timer<detail::tsc_clock>;
+
+// Selected with the NVBench_CPU_TIMER CMake option:
+#if defined(NVBENCH_CPU_TIMER_TSC)
+using cpu_timer = tsc_cpu_timer;
+#elif defined(NVBENCH_CPU_TIMER_MONOTONIC_RAW)
+using cpu_timer = monotonic_raw_cpu_timer;
+#else
+using cpu_timer = chrono_cpu_timer;
+#endif
+
 } // namespace nvbench
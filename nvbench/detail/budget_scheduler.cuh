@@ -0,0 +1,113 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace nvbench
+{
+struct state;
+}
+
+namespace nvbench::detail
+{
+
+/*!
+ * Spreads a fixed walltime budget over all states of a run (`--time-budget`).
+ *
+ * Before each state runs, `schedule` replaces its `timeout` with an even
+ * share of the remaining budget, scaled by how much walltime recent states
+ * used relative to their timeout (a state usually runs a cold and a batch
+ * measurement, each of which may use the full timeout). Time left over by
+ * states that converge early is redistributed to the states that follow.
+ *
+ * When the states completed so far predict that the rest will not fit, the
+ * run is behind schedule: `min_time` is divided and `max_noise` multiplied by
+ * the predicted overrun so that measurements converge sooner.
+ *
+ * All members are thread-safe; states of different devices may be scheduled
+ * concurrently (`--parallel-devices`), in which case the remaining budget is
+ * shared by the states that are in flight.
+ */
+struct budget_scheduler
+{
+  budget_scheduler(nvbench::float64_t budget, std::size_t total_states);
+
+  /// Adjust `exec_state`'s termination criteria to fit the remaining budget.
+  /// Must be followed by `complete(exec_state)` once the state has run.
+  void schedule(nvbench::state &exec_state);
+
+  /// Record the walltime used by `exec_state`. Returns true when this was the
+  /// last state of the run.
+  bool complete(const nvbench::state &exec_state);
+
+  /// Remove a state that will not be run, e.g. because it was restored by
+  /// `--resume`, from the run. Returns true if all other states have
+  /// completed.
+  bool remove_state();
+
+  [[nodiscard]] nvbench::float64_t get_budget() const { return m_budget; }
+  [[nodiscard]] std::size_t get_total_states() const;
+
+  /// Seconds since the first state was scheduled.
+  [[nodiscard]] nvbench::float64_t get_elapsed() const;
+
+  /// A one-line summary of how the budget was spent.
+  [[nodiscard]] std::string get_report() const;
+
+  /// Timeouts are never set below this many seconds.
+  static constexpr nvbench::float64_t min_timeout = 1e-3;
+  /// `min_time` and `max_noise` are scaled by at most this factor.
+  static constexpr nvbench::float64_t max_pressure = 16.;
+
+private:
+  using clock_type = std::chrono::steady_clock;
+
+  [[nodiscard]] nvbench::float64_t elapsed_since(clock_type::time_point start) const;
+
+  nvbench::float64_t m_budget;
+  std::size_t m_total_states;
+
+  mutable std::mutex m_mutex;
+
+  bool m_started{false};
+  clock_type::time_point m_start_time;
+  std::unordered_map<const nvbench::state *, clock_type::time_point> m_running;
+  std::size_t m_scheduled{0};
+  std::size_t m_completed{0};
+  std::size_t m_measured{0};
+  std::size_t m_tightened{0};
+
+  // Exponential moving averages over the states that were not skipped:
+  nvbench::float64_t m_mean_walltime{0.};
+  nvbench::float64_t m_mean_timeout_ratio{2.};
+
+  nvbench::float64_t m_min_allotted{0.};
+  nvbench::float64_t m_max_allotted{0.};
+  nvbench::float64_t m_max_pressure{0.};
+  nvbench::float64_t m_end_time{0.};
+};
+
+} // namespace nvbench::detail
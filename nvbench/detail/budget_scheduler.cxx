@@ -0,0 +1,210 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/budget_scheduler.cuh>
+
+#include <nvbench/state.cuh>
+#include <nvbench/summary_registry.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace nvbench::detail
+{
+
+namespace
+{
+
+// Weight of the most recent state in the moving averages:
+constexpr nvbench::float64_t ema_weight = 0.25;
+
+// States that converge well before their timeout would otherwise be given
+// arbitrarily long timeouts:
+constexpr nvbench::float64_t min_timeout_ratio = 0.5;
+
+} // namespace
+
+budget_scheduler::budget_scheduler(nvbench::float64_t budget, std::size_t total_states)
+    : m_budget{budget}
+    , m_total_states{total_states}
+{
+  if (!(budget > 0.))
+  {
+    NVBENCH_THROW(std::invalid_argument, "Time budget must be positive, got {}s.", budget);
+  }
+}
+
+void budget_scheduler::schedule(nvbench::state &exec_state)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  const auto now = clock_type::now();
+  if (!m_started)
+  {
+    m_start_time = now;
+    m_started    = true;
+  }
+
+  const nvbench::float64_t elapsed =
+    std::chrono::duration<nvbench::float64_t>(now - m_start_time).count();
+  const nvbench::float64_t remaining = std::max(m_budget - elapsed, 0.);
+
+  // States that are already running share the remaining time with this one
+  // and those that have not started yet, each device contributing a lane:
+  const std::size_t lanes = m_running.size() + 1;
+  const std::size_t unfinished =
+    std::max(m_total_states, m_scheduled + 1) - m_scheduled + m_running.size();
+  const nvbench::float64_t share =
+    remaining * static_cast<nvbench::float64_t>(lanes) / static_cast<nvbench::float64_t>(unfinished);
+
+  const nvbench::float64_t timeout =
+    std::clamp(share / m_mean_timeout_ratio, min_timeout, std::max(remaining, min_timeout));
+  exec_state.set_timeout(timeout);
+
+  // Predict whether the unfinished states fit in the remaining time at the
+  // pace observed so far:
+  if (m_measured > 0)
+  {
+    const nvbench::float64_t predicted = m_mean_walltime *
+                                         static_cast<nvbench::float64_t>(unfinished) /
+                                         static_cast<nvbench::float64_t>(lanes);
+    const nvbench::float64_t pressure =
+      remaining > 0. ? std::min(predicted / remaining, max_pressure) : max_pressure;
+    if (pressure > 1.)
+    {
+      exec_state.set_min_time(exec_state.get_min_time() / pressure);
+      exec_state.set_max_noise(exec_state.get_max_noise() * pressure);
+      m_max_pressure = std::max(m_max_pressure, pressure);
+      ++m_tightened;
+    }
+  }
+
+  m_min_allotted = m_scheduled == 0 ? timeout : std::min(m_min_allotted, timeout);
+  m_max_allotted = std::max(m_max_allotted, timeout);
+  ++m_scheduled;
+  m_running[&exec_state] = now;
+
+  static const auto &schema =
+    summary_registry::get().intern("nv/budget/timeout",
+                                   "Budget Timeout",
+                                   "duration",
+                                   "Measurement timeout allotted by --time-budget",
+                                   "Hidden by default.");
+  exec_state.add_summary(schema).set_float64("value", timeout);
+}
+
+bool budget_scheduler::complete(const nvbench::state &exec_state)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  const auto iter = m_running.find(&exec_state);
+  if (iter == m_running.end())
+  {
+    NVBENCH_THROW(std::runtime_error, "{}", "State completed without being scheduled.");
+  }
+  const nvbench::float64_t walltime = this->elapsed_since(iter->second);
+  m_running.erase(iter);
+  ++m_completed;
+
+  // Skipped states say nothing about how long measurements take:
+  if (!exec_state.is_skipped())
+  {
+    const nvbench::float64_t ratio =
+      std::max(walltime / exec_state.get_timeout(), min_timeout_ratio);
+    if (m_measured == 0)
+    {
+      m_mean_walltime      = walltime;
+      m_mean_timeout_ratio = ratio;
+    }
+    else
+    {
+      m_mean_walltime += ema_weight * (walltime - m_mean_walltime);
+      m_mean_timeout_ratio += ema_weight * (ratio - m_mean_timeout_ratio);
+    }
+    ++m_measured;
+  }
+
+  if (m_completed == m_total_states)
+  {
+    m_end_time = this->elapsed_since(m_start_time);
+    return true;
+  }
+  return false;
+}
+
+bool budget_scheduler::remove_state()
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  if (m_total_states > 0)
+  {
+    --m_total_states;
+  }
+  if (m_completed == m_total_states)
+  {
+    m_end_time = m_started ? this->elapsed_since(m_start_time) : 0.;
+    return true;
+  }
+  return false;
+}
+
+std::size_t budget_scheduler::get_total_states() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_total_states;
+}
+
+nvbench::float64_t budget_scheduler::get_elapsed() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_started ? this->elapsed_since(m_start_time) : 0.;
+}
+
+std::string budget_scheduler::get_report() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  const nvbench::float64_t elapsed =
+    m_completed == m_total_states ? m_end_time
+                                  : (m_started ? this->elapsed_since(m_start_time) : 0.);
+
+  auto report = fmt::format("Time budget: {:.2f}s of {:.2f}s used by {} states ({} measured), "
+                            "timeouts {:.3f}s to {:.3f}s",
+                            elapsed,
+                            m_budget,
+                            m_completed,
+                            m_measured,
+                            m_min_allotted,
+                            m_max_allotted);
+  if (m_tightened > 0)
+  {
+    report += fmt::format(", {} states tightened by up to {:.2f}x", m_tightened, m_max_pressure);
+  }
+  report += ".";
+  return report;
+}
+
+nvbench::float64_t budget_scheduler::elapsed_since(clock_type::time_point start) const
+{
+  return std::chrono::duration<nvbench::float64_t>(clock_type::now() - start).count();
+}
+
+} // namespace nvbench::detail
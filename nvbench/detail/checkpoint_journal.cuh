@@ -0,0 +1,94 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/summary.cuh>
+
+#include <cstddef>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace nvbench
+{
+struct state;
+}
+
+namespace nvbench::detail
+{
+
+/*!
+ * Append-only journal of completed states (`--checkpoint` / `--resume`).
+ *
+ * Each completed state is written as one line of JSON holding its skip reason
+ * and summaries, and the file is synced to disk before the state is reported
+ * as complete, so a run that is interrupted loses at most the states that were
+ * running.
+ *
+ * When resuming, the states recorded by an earlier run are loaded and
+ * `restore` hands their results back to the matching states of this run,
+ * which are then not measured again. States are matched by benchmark name,
+ * device and axis values (see `nvbench::hash_config`). A torn final line left
+ * by an interrupted write is discarded.
+ *
+ * All members are thread-safe.
+ */
+struct checkpoint_journal
+{
+  /// Opens `filename` for appending. If `resume` is true, the states it
+  /// already records are loaded and kept; otherwise it is truncated. A missing
+  /// file is created either way.
+  checkpoint_journal(std::string filename, bool resume);
+  ~checkpoint_journal();
+
+  checkpoint_journal(const checkpoint_journal &)            = delete;
+  checkpoint_journal &operator=(const checkpoint_journal &) = delete;
+
+  /// Appends the results of `exec_state` and syncs them to disk.
+  void record(const nvbench::state &exec_state);
+
+  /// If an earlier run recorded `exec_state`, moves its summaries and skip
+  /// reason into `exec_state` and returns true. Each recorded state is
+  /// restored at most once.
+  bool restore(nvbench::state &exec_state);
+
+  [[nodiscard]] const std::string &get_filename() const { return m_filename; }
+
+  /// Number of loaded states that have not been restored yet.
+  [[nodiscard]] std::size_t get_restorable_count() const;
+
+private:
+  struct entry
+  {
+    std::string skip_reason;
+    std::vector<nvbench::summary> summaries;
+  };
+
+  void load();
+
+  std::string m_filename;
+  std::FILE *m_file{};
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, entry> m_entries;
+};
+
+} // namespace nvbench::detail
@@ -0,0 +1,313 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/checkpoint_journal.cuh>
+
+#include <nvbench/benchmark_base.cuh>
+#include <nvbench/sharding.cuh>
+#include <nvbench/state.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <nlohmann/json.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace nvbench::detail
+{
+
+namespace
+{
+
+std::string make_key(std::string_view benchmark_name,
+                     nvbench::int64_t device_id,
+                     std::string_view config)
+{
+  return fmt::format("{}\x1f{}\x1f{}", benchmark_name, device_id, config);
+}
+
+nvbench::int64_t get_device_id(const nvbench::state &exec_state)
+{
+  const auto &device = exec_state.get_device();
+  return device ? device->get_id() : -1;
+}
+
+std::string get_config(const nvbench::state &exec_state)
+{
+  return fmt::format("{:016x}",
+                     nvbench::hash_config(exec_state.get_benchmark().get_name(),
+                                          exec_state.get_axis_values()));
+}
+
+// Values are stored as strings, as in the JSON output, so float64s and
+// int64s round-trip exactly:
+nlohmann::ordered_json summary_to_json(const nvbench::summary &summ)
+{
+  nlohmann::ordered_json data = nlohmann::ordered_json::array();
+  for (const auto &name : summ.get_names())
+  {
+    nlohmann::ordered_json value;
+    value["name"] = name;
+    switch (summ.get_type(name))
+    {
+      case nvbench::named_values::type::int64:
+        value["type"]  = "int64";
+        value["value"] = fmt::to_string(summ.get_int64(name));
+        break;
+      case nvbench::named_values::type::float64:
+        value["type"]  = "float64";
+        value["value"] = fmt::to_string(summ.get_float64(name));
+        break;
+      case nvbench::named_values::type::string:
+        value["type"]  = "string";
+        value["value"] = summ.get_string(name);
+        break;
+    }
+    data.push_back(std::move(value));
+  }
+
+  nlohmann::ordered_json result;
+  result["tag"]  = summ.get_tag();
+  result["data"] = std::move(data);
+  return result;
+}
+
+nvbench::summary summary_from_json(const nlohmann::json &summ_json)
+{
+  nvbench::summary summ{summ_json.at("tag").get<std::string>()};
+  for (const auto &value : summ_json.at("data"))
+  {
+    auto name        = value.at("name").get<std::string>();
+    const auto &type = value.at("type").get_ref<const std::string &>();
+    auto str         = value.at("value").get<std::string>();
+    if (type == "int64")
+    {
+      summ.set_int64(std::move(name), std::stoll(str));
+    }
+    else if (type == "float64")
+    {
+      summ.set_float64(std::move(name), std::stod(str));
+    }
+    else if (type == "string")
+    {
+      summ.set_string(std::move(name), std::move(str));
+    }
+    else
+    {
+      NVBENCH_THROW(std::runtime_error, "Unrecognized value type `{}`.", type);
+    }
+  }
+  return summ;
+}
+
+void sync_file(std::FILE *file)
+{
+  if (std::fflush(file) != 0)
+  {
+    NVBENCH_THROW(std::runtime_error, "Write failed: {}", std::strerror(errno));
+  }
+#ifdef _WIN32
+  const int result = ::_commit(::_fileno(file));
+#else
+  const int result = ::fsync(::fileno(file));
+#endif
+  if (result != 0)
+  {
+    NVBENCH_THROW(std::runtime_error, "Sync failed: {}", std::strerror(errno));
+  }
+}
+
+} // namespace
+
+checkpoint_journal::checkpoint_journal(std::string filename, bool resume)
+    : m_filename{std::move(filename)}
+{
+  if (resume)
+  {
+    this->load();
+  }
+
+  m_file = std::fopen(m_filename.c_str(), resume ? "ab" : "wb");
+  if (m_file == nullptr)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Unable to open checkpoint journal '{}': {}",
+                  m_filename,
+                  std::strerror(errno));
+  }
+}
+
+checkpoint_journal::~checkpoint_journal()
+{
+  if (m_file != nullptr)
+  {
+    std::fclose(m_file);
+  }
+}
+
+void checkpoint_journal::load()
+try
+{
+  std::ifstream file{m_filename, std::ios::binary};
+  if (!file)
+  { // Nothing to resume yet.
+    return;
+  }
+
+  std::uintmax_t valid_size = 0;
+  std::size_t line_number   = 0;
+  std::string line;
+  while (std::getline(file, line))
+  {
+    ++line_number;
+    if (file.eof())
+    { // No trailing newline: the final write was interrupted.
+      break;
+    }
+    valid_size += line.size() + 1;
+    if (line.empty())
+    {
+      continue;
+    }
+
+    try
+    {
+      const auto root = nlohmann::json::parse(line);
+
+      entry cur_entry;
+      if (const auto iter = root.find("skip_reason"); iter != root.end())
+      {
+        cur_entry.skip_reason = iter->get<std::string>();
+      }
+      for (const auto &summ : root.at("summaries"))
+      {
+        cur_entry.summaries.push_back(summary_from_json(summ));
+      }
+
+      // A later line for the same state replaces an earlier one:
+      m_entries[make_key(root.at("benchmark").get_ref<const std::string &>(),
+                         root.at("device").get<nvbench::int64_t>(),
+                         root.at("config").get_ref<const std::string &>())] = std::move(cur_entry);
+    }
+    catch (std::exception &e)
+    {
+      NVBENCH_THROW(std::runtime_error, "Line {}: {}", line_number, e.what());
+    }
+  }
+  file.close();
+
+  // Drop the torn line so that new records start on a line of their own:
+  if (std::filesystem::file_size(m_filename) != valid_size)
+  {
+    std::filesystem::resize_file(m_filename, valid_size);
+  }
+}
+catch (std::exception &e)
+{
+  NVBENCH_THROW(std::runtime_error,
+                "Error reading checkpoint journal '{}':\n{}",
+                m_filename,
+                e.what());
+}
+
+void checkpoint_journal::record(const nvbench::state &exec_state)
+{
+  nlohmann::ordered_json summaries = nlohmann::ordered_json::array();
+  for (const auto &summ : exec_state.get_summaries())
+  {
+    summaries.push_back(summary_to_json(summ));
+  }
+
+  nlohmann::ordered_json root;
+  root["benchmark"] = exec_state.get_benchmark().get_name();
+  root["device"]    = get_device_id(exec_state);
+  root["config"]    = get_config(exec_state);
+  root["name"]      = exec_state.get_axis_values_as_string();
+  if (exec_state.is_skipped())
+  {
+    root["skip_reason"] = exec_state.get_skip_reason();
+  }
+  root["summaries"] = std::move(summaries);
+
+  std::string line = root.dump();
+  line += '\n';
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  try
+  {
+    if (std::fwrite(line.data(), 1, line.size(), m_file) != line.size())
+    {
+      NVBENCH_THROW(std::runtime_error, "Write failed: {}", std::strerror(errno));
+    }
+    sync_file(m_file);
+  }
+  catch (std::exception &e)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Error writing checkpoint journal '{}':\n{}",
+                  m_filename,
+                  e.what());
+  }
+}
+
+bool checkpoint_journal::restore(nvbench::state &exec_state)
+{
+  const auto key = make_key(exec_state.get_benchmark().get_name(),
+                            get_device_id(exec_state),
+                            get_config(exec_state));
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  const auto iter = m_entries.find(key);
+  if (iter == m_entries.end())
+  {
+    return false;
+  }
+
+  auto &cur_entry = iter->second;
+  if (!cur_entry.skip_reason.empty())
+  {
+    exec_state.skip(std::move(cur_entry.skip_reason));
+  }
+  for (auto &summ : cur_entry.summaries)
+  {
+    exec_state.add_summary(std::move(summ));
+  }
+  m_entries.erase(iter);
+  return true;
+}
+
+std::size_t checkpoint_journal::get_restorable_count() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_entries.size();
+}
+
+} // namespace nvbench::detail
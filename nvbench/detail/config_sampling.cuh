@@ -0,0 +1,47 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/sampling.cuh>
+
+#include <cstdint>
+#include <vector>
+
+namespace nvbench::detail
+{
+
+/**
+ * Selects up to `count` distinct points from a mixed-radix space with the
+ * given dimension sizes, where the first dimension varies fastest.
+ *
+ * Returns the linear indices of the selected points in ascending order. The
+ * space is never enumerated, so the cost scales with `count` rather than the
+ * size of the space. If `count` is at least the size of the space, every
+ * index is returned. Results are deterministic for a given `seed`.
+ */
+[[nodiscard]] std::vector<std::uint64_t> sample_configs(nvbench::sample_method method,
+                                                        std::uint64_t count,
+                                                        const std::vector<std::uint64_t> &dim_sizes,
+                                                        std::uint64_t seed);
+
+/// Maximum number of dimensions (with more than one value) supported by
+/// `sample_method::sobol`.
+inline constexpr std::size_t max_sobol_dimensions = 16;
+
+} // namespace nvbench::detail
@@ -0,0 +1,369 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/config_sampling.cuh>
+
+#include <nvbench/detail/statistics.cuh>
+#include <nvbench/detail/throw.cuh>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace nvbench::detail
+{
+
+namespace
+{
+
+using rng_type = nvbench::detail::statistics::xoshiro256ss;
+
+// A uniformly distributed integer in [0, bound) for any bound > 0.
+std::uint64_t uniform_below(rng_type &rng, std::uint64_t bound)
+{
+  // Rejection sampling avoids modulo bias:
+  const std::uint64_t threshold = (0 - bound) % bound;
+  while (true)
+  {
+    const std::uint64_t r = rng();
+    if (r >= threshold)
+    {
+      return r % bound;
+    }
+  }
+}
+
+// A uniformly distributed double in [0, 1).
+nvbench::float64_t uniform_unit(rng_type &rng)
+{
+  return static_cast<nvbench::float64_t>(rng() >> 11) * 0x1.0p-53;
+}
+
+// Maps u in [0, 1) to an index in [0, size).
+std::uint64_t scale_unit(nvbench::float64_t u, std::uint64_t size)
+{
+  const auto index = static_cast<std::uint64_t>(u * static_cast<nvbench::float64_t>(size));
+  return std::min(index, size - 1);
+}
+
+struct mixed_radix
+{
+  explicit mixed_radix(const std::vector<std::uint64_t> &sizes)
+      : m_sizes{sizes}
+      , m_strides(sizes.size())
+  {
+    std::uint64_t stride = 1;
+    for (std::size_t d = 0; d < sizes.size(); ++d)
+    {
+      m_strides[d] = stride;
+      stride *= sizes[d];
+    }
+  }
+
+  [[nodiscard]] std::uint64_t to_linear(const std::vector<std::uint64_t> &coords) const
+  {
+    return std::inner_product(coords.cbegin(), coords.cend(), m_strides.cbegin(), std::uint64_t{});
+  }
+
+  const std::vector<std::uint64_t> &m_sizes;
+  std::vector<std::uint64_t> m_strides;
+};
+
+// Floyd's algorithm: `count` distinct values from [0, total) in O(count).
+std::vector<std::uint64_t> sample_random(std::uint64_t count, std::uint64_t total, rng_type &rng)
+{
+  std::unordered_set<std::uint64_t> selected;
+  selected.reserve(count);
+  for (std::uint64_t j = total - count; j < total; ++j)
+  {
+    const std::uint64_t t = uniform_below(rng, j + 1);
+    if (!selected.insert(t).second)
+    {
+      selected.insert(j);
+    }
+  }
+  return {selected.cbegin(), selected.cend()};
+}
+
+std::vector<std::uint64_t>
+sample_lhs(std::uint64_t count, const std::vector<std::uint64_t> &sizes, rng_type &rng)
+{
+  const mixed_radix radix{sizes};
+
+  // One random permutation of the `count` strata per dimension:
+  std::vector<std::vector<std::uint64_t>> strata(sizes.size());
+  for (auto &perm : strata)
+  {
+    perm.resize(count);
+    std::iota(perm.begin(), perm.end(), std::uint64_t{});
+    for (std::uint64_t i = count - 1; i > 0; --i)
+    {
+      std::swap(perm[i], perm[uniform_below(rng, i + 1)]);
+    }
+  }
+
+  const auto n = static_cast<nvbench::float64_t>(count);
+  std::vector<std::uint64_t> result;
+  result.reserve(count);
+  std::vector<std::uint64_t> coords(sizes.size());
+  for (std::uint64_t i = 0; i < count; ++i)
+  {
+    for (std::size_t d = 0; d < sizes.size(); ++d)
+    {
+      const auto u = (static_cast<nvbench::float64_t>(strata[d][i]) + uniform_unit(rng)) / n;
+      coords[d]    = scale_unit(u, sizes[d]);
+    }
+    result.push_back(radix.to_linear(coords));
+  }
+  return result;
+}
+
+// Primitive polynomials and initial direction numbers for Sobol dimensions
+// 2-16, from Joe & Kuo's "new-joe-kuo-6.21201" table. Dimension 1 is the van
+// der Corput sequence.
+struct sobol_init
+{
+  unsigned degree;
+  unsigned coeffs;
+  std::array<std::uint32_t, 6> m;
+};
+
+constexpr std::array<sobol_init, max_sobol_dimensions - 1> sobol_inits{{
+  {1, 0, {1}},
+  {2, 1, {1, 3}},
+  {3, 1, {1, 3, 1}},
+  {3, 2, {1, 1, 1}},
+  {4, 1, {1, 1, 3, 3}},
+  {4, 4, {1, 3, 5, 13}},
+  {5, 2, {1, 1, 5, 5, 17}},
+  {5, 4, {1, 1, 5, 5, 5}},
+  {5, 7, {1, 1, 7, 11, 19}},
+  {5, 11, {1, 1, 5, 1, 1}},
+  {5, 13, {1, 1, 1, 3, 11}},
+  {5, 14, {1, 3, 5, 5, 31}},
+  {6, 1, {1, 3, 3, 9, 7, 49}},
+  {6, 13, {1, 1, 1, 15, 21, 21}},
+  {6, 16, {1, 3, 1, 13, 27, 49}},
+}};
+
+// Gray-code Sobol generator with 32 bits of resolution per dimension.
+struct sobol_sequence
+{
+  static constexpr unsigned bits = 32;
+
+  explicit sobol_sequence(std::size_t dims)
+      : m_directions(dims)
+      , m_point(dims)
+  {
+    for (std::size_t d = 0; d < dims; ++d)
+    {
+      auto &v = m_directions[d];
+      if (d == 0)
+      {
+        for (unsigned k = 0; k < bits; ++k)
+        {
+          v[k] = std::uint32_t{1} << (bits - 1 - k);
+        }
+        continue;
+      }
+
+      const auto &init = sobol_inits[d - 1];
+      const unsigned s = init.degree;
+      for (unsigned k = 0; k < s; ++k)
+      {
+        v[k] = init.m[k] << (bits - 1 - k);
+      }
+      for (unsigned k = s; k < bits; ++k)
+      {
+        v[k] = v[k - s] ^ (v[k - s] >> s);
+        for (unsigned j = 1; j < s; ++j)
+        {
+          if ((init.coeffs >> (s - 1 - j)) & 1u)
+          {
+            v[k] ^= v[k - j];
+          }
+        }
+      }
+    }
+  }
+
+  // Returns the current point and advances to the next one.
+  const std::vector<std::uint32_t> &next()
+  {
+    m_result = m_point;
+
+    // Index of the lowest zero bit of the point index:
+    unsigned c = 0;
+    for (std::uint64_t n = m_index; n & 1u; n >>= 1)
+    {
+      ++c;
+    }
+    if (c < bits)
+    {
+      for (std::size_t d = 0; d < m_point.size(); ++d)
+      {
+        m_point[d] ^= m_directions[d][c];
+      }
+    }
+    ++m_index;
+    return m_result;
+  }
+
+private:
+  std::vector<std::array<std::uint32_t, bits>> m_directions;
+  std::vector<std::uint32_t> m_point;
+  std::vector<std::uint32_t> m_result;
+  std::uint64_t m_index{};
+};
+
+std::vector<std::uint64_t> sample_sobol(std::uint64_t count,
+                                        std::uint64_t total,
+                                        const std::vector<std::uint64_t> &sizes,
+                                        rng_type &rng)
+{
+  if (sizes.size() > max_sobol_dimensions)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Sobol sampling supports at most {} axes with more than one value (got {}).",
+                  max_sobol_dimensions,
+                  sizes.size());
+  }
+
+  const mixed_radix radix{sizes};
+  sobol_sequence sequence{sizes.size()};
+
+  // A random digital shift decorrelates runs with different seeds while
+  // preserving the sequence's equidistribution:
+  std::vector<std::uint32_t> shift(sizes.size());
+  for (auto &s : shift)
+  {
+    s = static_cast<std::uint32_t>(rng() >> 32);
+  }
+
+  // Coarse axes map several sequence points onto the same config; keep
+  // drawing until enough distinct configs are found:
+  const std::uint64_t max_draws = std::min<std::uint64_t>(
+    std::max<std::uint64_t>(64 * count, total),
+    std::uint64_t{1} << sobol_sequence::bits);
+
+  std::unordered_set<std::uint64_t> selected;
+  selected.reserve(count);
+  std::vector<std::uint64_t> coords(sizes.size());
+  for (std::uint64_t draw = 0; draw < max_draws && selected.size() < count; ++draw)
+  {
+    const auto &point = sequence.next();
+    for (std::size_t d = 0; d < sizes.size(); ++d)
+    {
+      const auto u = static_cast<nvbench::float64_t>(point[d] ^ shift[d]) * 0x1.0p-32;
+      coords[d]    = scale_unit(u, sizes[d]);
+    }
+    selected.insert(radix.to_linear(coords));
+  }
+  return {selected.cbegin(), selected.cend()};
+}
+
+} // namespace
+
+std::vector<std::uint64_t> sample_configs(nvbench::sample_method method,
+                                          std::uint64_t count,
+                                          const std::vector<std::uint64_t> &dim_sizes,
+                                          std::uint64_t seed)
+{
+  std::uint64_t total = 1;
+  for (const auto size : dim_sizes)
+  {
+    if (size != 0 && total > std::numeric_limits<std::uint64_t>::max() / size)
+    {
+      NVBENCH_THROW(std::runtime_error, "{}", "Parameter space is too large to sample.");
+    }
+    total *= size;
+  }
+
+  std::vector<std::uint64_t> result;
+  if (method == nvbench::sample_method::none || count >= total)
+  {
+    result.resize(total);
+    std::iota(result.begin(), result.end(), std::uint64_t{});
+    return result;
+  }
+
+  // Dimensions with a single value don't affect the sample. Dropping them
+  // keeps Sobol's dimension limit about the axes that actually vary:
+  std::vector<std::uint64_t> sizes;
+  std::vector<std::uint64_t> strides;
+  {
+    std::uint64_t stride = 1;
+    for (const auto size : dim_sizes)
+    {
+      if (size > 1)
+      {
+        sizes.push_back(size);
+        strides.push_back(stride);
+      }
+      stride *= size;
+    }
+  }
+
+  rng_type rng{seed};
+  switch (method)
+  {
+    case nvbench::sample_method::random:
+      result = sample_random(count, total, rng);
+      break;
+
+    case nvbench::sample_method::lhs:
+      result = sample_lhs(count, sizes, rng);
+      break;
+
+    case nvbench::sample_method::sobol:
+      result = sample_sobol(count, total, sizes, rng);
+      break;
+
+    default:
+      NVBENCH_THROW(std::runtime_error,
+                    "Unsupported sample method `{}`.",
+                    nvbench::sample_method_to_string(method));
+  }
+
+  // Map indices in the reduced space back to the full space. Random sampling
+  // already works on the full space:
+  if (method != nvbench::sample_method::random)
+  {
+    const mixed_radix radix{sizes};
+    for (auto &index : result)
+    {
+      std::uint64_t full = 0;
+      for (std::size_t d = sizes.size(); d-- > 0;)
+      {
+        full += (index / radix.m_strides[d]) * strides[d];
+        index %= radix.m_strides[d];
+      }
+      index = full;
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+} // namespace nvbench::detail
@@ -0,0 +1,142 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/cpu_timer.cuh>
+#include <nvbench/types.cuh>
+
+#include <nvbench/detail/ring_buffer.cuh>
+
+#include <cmath>
+#include <cstddef>
+
+namespace nvbench
+{
+struct printer_base;
+struct state;
+} // namespace nvbench
+
+namespace nvbench::detail
+{
+
+/**
+ * The stopping criteria shared by the cold, cpu and batch measurements.
+ *
+ * A measurement has converged once it has more than `min_samples` samples and
+ * `min_time` of measured time, and its noise (relative standard deviation) is
+ * either below `max_noise` or has stopped changing. It ends without
+ * converging once its walltime exceeds `timeout`.
+ *
+ * The measurement reports its noise after each sample with `add_noise`. The
+ * trailing window of noise values keeps windowed statistics, so checking for
+ * stability is O(1) per sample.
+ */
+struct convergence_criteria
+{
+  /// Noise values inspected by the stability check.
+  static constexpr std::size_t noise_window = 512;
+
+  /// Noise values required before checking for stability.
+  static constexpr std::size_t min_stable_noise_count = 64;
+
+  /// The noise is stable once the relative standard deviation of the trailing
+  /// noise values is below this.
+  static constexpr nvbench::float64_t stable_noise_threshold = 0.05;
+
+  /// Reads the criteria of `exec_state`.
+  explicit convergence_criteria(const nvbench::state &exec_state);
+
+  void clear();
+
+  /// Records the noise after a new sample. Non-finite values, e.g. before
+  /// there are two samples, are ignored.
+  void add_noise(nvbench::float64_t rel_stdev)
+  {
+    if (std::isfinite(rel_stdev))
+    {
+      m_noise_tracker.push_back(rel_stdev);
+    }
+  }
+
+  /// The most recent noise, or infinity if none has been recorded.
+  [[nodiscard]] nvbench::float64_t get_noise() const;
+
+  /// True once more than `min_samples` samples taking more than `min_time`
+  /// in total have been recorded.
+  [[nodiscard]] bool has_min_samples(nvbench::float64_t total_time,
+                                     nvbench::int64_t total_samples) const
+  {
+    return total_time > m_min_time && total_samples > m_min_samples;
+  }
+
+  /// True if the noise is below `max_noise`, or has stabilized above it so
+  /// that an inherently noisy measurement will never reach `max_noise`.
+  [[nodiscard]] bool is_noise_converged() const;
+
+  /// Stops `walltime_timer` and checks it against the timeout. Once this
+  /// returns true, `is_timed_out()` does too.
+  bool check_timeout(nvbench::cpu_timer &walltime_timer);
+
+  /// The usual stopping rule: `has_min_samples() && is_noise_converged()`,
+  /// or `check_timeout()`.
+  bool is_finished(nvbench::float64_t total_time,
+                   nvbench::int64_t total_samples,
+                   nvbench::cpu_timer &walltime_timer)
+  {
+    if (this->has_min_samples(total_time, total_samples) && this->is_noise_converged())
+    {
+      return true;
+    }
+    return this->check_timeout(walltime_timer);
+  }
+
+  [[nodiscard]] bool is_timed_out() const { return m_timed_out; }
+
+  /// If the measurement timed out, warns about each criterion it did not
+  /// meet. Pass `check_noise = false` when a different criterion than
+  /// `max_noise` was used to stop.
+  void log_timeout_warnings(nvbench::printer_base &printer,
+                            nvbench::float64_t walltime,
+                            nvbench::float64_t total_time,
+                            nvbench::int64_t total_samples,
+                            bool check_noise = true) const;
+
+  [[nodiscard]] nvbench::int64_t get_min_samples() const { return m_min_samples; }
+  void set_min_samples(nvbench::int64_t min_samples) { m_min_samples = min_samples; }
+
+  [[nodiscard]] nvbench::float64_t get_min_time() const { return m_min_time; }
+  void set_min_time(nvbench::float64_t min_time) { m_min_time = min_time; }
+
+  [[nodiscard]] nvbench::float64_t get_max_noise() const { return m_max_noise; }
+
+  [[nodiscard]] nvbench::float64_t get_timeout() const { return m_timeout; }
+
+private:
+  nvbench::int64_t m_min_samples{};
+  nvbench::float64_t m_min_time{};
+  nvbench::float64_t m_max_noise{}; // rel stdev
+  nvbench::float64_t m_timeout{};
+
+  // Trailing history of noise measurements:
+  nvbench::detail::ring_buffer<nvbench::float64_t, true> m_noise_tracker{noise_window};
+
+  bool m_timed_out{false};
+};
+
+} // namespace nvbench::detail
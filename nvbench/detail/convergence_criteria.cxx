@@ -0,0 +1,138 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/convergence_criteria.cuh>
+
+#include <nvbench/printer_base.cuh>
+#include <nvbench/state.cuh>
+
+#include <fmt/format.h>
+
+#include <limits>
+
+namespace nvbench::detail
+{
+
+convergence_criteria::convergence_criteria(const nvbench::state &exec_state)
+    : m_min_samples{exec_state.get_min_samples()}
+    , m_min_time{exec_state.get_min_time()}
+    , m_max_noise{exec_state.get_max_noise()}
+    , m_timeout{exec_state.get_timeout()}
+{}
+
+void convergence_criteria::clear()
+{
+  m_noise_tracker.clear();
+  m_timed_out = false;
+}
+
+nvbench::float64_t convergence_criteria::get_noise() const
+{
+  return m_noise_tracker.empty() ? std::numeric_limits<nvbench::float64_t>::infinity()
+                                 : m_noise_tracker.back();
+}
+
+bool convergence_criteria::is_noise_converged() const
+{
+  if (m_noise_tracker.empty())
+  {
+    return false;
+  }
+
+  // Noise has dropped below threshold
+  const auto current_noise = m_noise_tracker.back();
+  if (current_noise < m_max_noise)
+  {
+    return true;
+  }
+
+  // Check if the noise has converged by inspecting a trailing window of
+  // recorded noise measurements.
+  // This helps identify benchmarks that are inherently noisy and would
+  // never converge to the target stdev threshold. This check ensures that the
+  // benchmark will end if the stdev stabilizes above the target threshold.
+  // Gather some iterations before checking noise.
+  if (m_noise_tracker.size() > min_stable_noise_count)
+  {
+    // Use the current noise as the stdev reference. If the rel stdev of the
+    // last N noise measurements is below the threshold, consider the result
+    // stable.
+    const auto noise_stdev     = m_noise_tracker.standard_deviation(current_noise);
+    const auto noise_rel_stdev = noise_stdev / current_noise;
+    if (noise_rel_stdev < stable_noise_threshold)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool convergence_criteria::check_timeout(nvbench::cpu_timer &walltime_timer)
+{
+  walltime_timer.stop();
+  if (walltime_timer.get_duration() > m_timeout)
+  {
+    m_timed_out = true;
+  }
+  return m_timed_out;
+}
+
+void convergence_criteria::log_timeout_warnings(nvbench::printer_base &printer,
+                                                nvbench::float64_t walltime,
+                                                nvbench::float64_t total_time,
+                                                nvbench::int64_t total_samples,
+                                                bool check_noise) const
+{
+  if (!m_timed_out)
+  {
+    return;
+  }
+
+  if (check_noise && !m_noise_tracker.empty() && m_noise_tracker.back() > m_max_noise)
+  {
+    printer.log(nvbench::log_level::warn,
+                fmt::format("Current measurement timed out ({:0.2f}s) "
+                            "while over noise threshold ({:0.2f}% > "
+                            "{:0.2f}%)",
+                            walltime,
+                            m_noise_tracker.back() * 100,
+                            m_max_noise * 100));
+  }
+  if (total_samples < m_min_samples)
+  {
+    printer.log(nvbench::log_level::warn,
+                fmt::format("Current measurement timed out ({:0.2f}s) "
+                            "before accumulating min_samples ({} < {})",
+                            walltime,
+                            total_samples,
+                            m_min_samples));
+  }
+  if (total_time < m_min_time)
+  {
+    printer.log(nvbench::log_level::warn,
+                fmt::format("Current measurement timed out ({:0.2f}s) "
+                            "before accumulating min_time ({:0.2f}s < "
+                            "{:0.2f}s)",
+                            walltime,
+                            total_time,
+                            m_min_time));
+  }
+}
+
+} // namespace nvbench::detail
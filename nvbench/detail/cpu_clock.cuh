@@ -0,0 +1,155 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <chrono>
+#include <cstdint>
+
+#include <time.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NVBENCH_HAS_TSC
+#include <x86intrin.h>
+#endif
+
+namespace nvbench::detail
+{
+
+// Clocks used by `nvbench::basic_cpu_timer`. Each clock returns raw ticks from
+// `start()` and `stop()` and only converts to seconds in `to_seconds()`, so the
+// timed region pays for a single clock read on either side.
+
+/// `std::chrono::high_resolution_clock`.
+struct chrono_clock
+{
+  using clock_type = std::chrono::high_resolution_clock;
+  using tick_type  = clock_type::rep;
+
+  static constexpr const char *name = "chrono";
+
+  __forceinline__ static tick_type start() { return clock_type::now().time_since_epoch().count(); }
+  __forceinline__ static tick_type stop() { return clock_type::now().time_since_epoch().count(); }
+
+  [[nodiscard]] static nvbench::float64_t to_seconds(tick_type ticks)
+  {
+    using period = clock_type::period;
+    return static_cast<nvbench::float64_t>(ticks) * period::num / period::den;
+  }
+};
+
+/// `clock_gettime(CLOCK_MONOTONIC_RAW)`, which is not subject to NTP slewing.
+/// Ticks are nanoseconds.
+struct monotonic_raw_clock
+{
+  using tick_type = std::int64_t;
+
+  static constexpr const char *name = "monotonic_raw";
+
+  __forceinline__ static tick_type start() { return now(); }
+  __forceinline__ static tick_type stop() { return now(); }
+
+  [[nodiscard]] static nvbench::float64_t to_seconds(tick_type ticks)
+  {
+    return static_cast<nvbench::float64_t>(ticks) * 1e-9;
+  }
+
+private:
+  __forceinline__ static tick_type now()
+  {
+#if defined(CLOCK_MONOTONIC_RAW) || defined(CLOCK_MONOTONIC)
+    timespec ts;
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return static_cast<tick_type>(ts.tv_sec) * 1000000000 + static_cast<tick_type>(ts.tv_nsec);
+#else
+    // No `clock_gettime` (e.g. MSVC); use the closest portable clock:
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+  }
+};
+
+/// The x86 time-stamp counter, read with `rdtsc` at the start and `rdtscp` at
+/// the stop so that the timed region can't be reordered around the reads.
+///
+/// The tick rate is calibrated against `CLOCK_MONOTONIC_RAW` the first time a
+/// duration is converted. Without an invariant TSC (or on other
+/// architectures) this clock falls back to `monotonic_raw_clock`.
+struct tsc_clock
+{
+  using tick_type = std::int64_t;
+
+  static constexpr const char *name = "tsc";
+
+  __forceinline__ static tick_type start()
+  {
+#ifdef NVBENCH_HAS_TSC
+    if (tsc_usable)
+    {
+      _mm_lfence();
+      const auto ticks = __rdtsc();
+      _mm_lfence();
+      return static_cast<tick_type>(ticks);
+    }
+#endif
+    return monotonic_raw_clock::start();
+  }
+
+  __forceinline__ static tick_type stop()
+  {
+#ifdef NVBENCH_HAS_TSC
+    if (tsc_usable)
+    {
+      unsigned int aux;
+      const auto ticks = __rdtscp(&aux);
+      _mm_lfence();
+      return static_cast<tick_type>(ticks);
+    }
+#endif
+    return monotonic_raw_clock::stop();
+  }
+
+  [[nodiscard]] static nvbench::float64_t to_seconds(tick_type ticks)
+  {
+    return static_cast<nvbench::float64_t>(ticks) * get_seconds_per_tick();
+  }
+
+  /// True if the TSC is invariant, i.e. ticks at a constant rate regardless
+  /// of frequency scaling and sleep states.
+  [[nodiscard]] static bool is_tsc_usable() { return tsc_usable; }
+
+  /// Seconds per tick, calibrated once per process.
+  [[nodiscard]] static nvbench::float64_t get_seconds_per_tick();
+
+private:
+  static bool detect_invariant_tsc();
+
+  // Detected once, during static initialization, so that reading the clock
+  // is a plain load and branch rather than a function-local static's guard
+  // check. Timers must not be started from other static initializers.
+  static const bool tsc_usable;
+};
+
+} // namespace nvbench::detail
@@ -0,0 +1,96 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/cpu_clock.cuh>
+
+#include <nvbench/detail/statistics.cuh>
+
+#include <vector>
+
+#ifdef NVBENCH_HAS_TSC
+#include <cpuid.h>
+#endif
+
+namespace nvbench::detail
+{
+
+namespace
+{
+
+#ifdef NVBENCH_HAS_TSC
+nvbench::float64_t calibrate_tsc()
+{
+  // Count TSC ticks over a few short CLOCK_MONOTONIC_RAW windows and keep the
+  // median rate, so a preemption during one window doesn't skew the result.
+  constexpr int num_windows              = 5;
+  constexpr std::int64_t window_duration = 2000000; // ns
+
+  std::vector<nvbench::float64_t> rates;
+  rates.reserve(num_windows);
+  for (int i = 0; i < num_windows; ++i)
+  {
+    const auto ns_start  = monotonic_raw_clock::start();
+    const auto tsc_start = tsc_clock::start();
+    auto ns_stop         = ns_start;
+    while (ns_stop - ns_start < window_duration)
+    {
+      ns_stop = monotonic_raw_clock::stop();
+    }
+    const auto tsc_stop = tsc_clock::stop();
+    rates.push_back(monotonic_raw_clock::to_seconds(ns_stop - ns_start) /
+                    static_cast<nvbench::float64_t>(tsc_stop - tsc_start));
+  }
+  return nvbench::detail::statistics::percentile(rates.begin(), rates.end(), 0.5);
+}
+#endif
+
+} // namespace
+
+const bool tsc_clock::tsc_usable = tsc_clock::detect_invariant_tsc();
+
+bool tsc_clock::detect_invariant_tsc()
+{
+#ifdef NVBENCH_HAS_TSC
+  // CPUID.80000007H:EDX[8] reports an invariant TSC. rdtscp is reported by
+  // CPUID.80000001H:EDX[27].
+  unsigned int eax{}, ebx{}, ecx{}, edx{};
+  if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) == 0 || (edx & (1u << 27)) == 0)
+  {
+    return false;
+  }
+  if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0)
+  {
+    return false;
+  }
+  return (edx & (1u << 8)) != 0;
+#else
+  return false;
+#endif
+}
+
+nvbench::float64_t tsc_clock::get_seconds_per_tick()
+{
+#ifdef NVBENCH_HAS_TSC
+  static const nvbench::float64_t seconds_per_tick = is_tsc_usable() ? calibrate_tsc() : 1e-9;
+  return seconds_per_tick;
+#else
+  return 1e-9;
+#endif
+}
+
+} // namespace nvbench::detail
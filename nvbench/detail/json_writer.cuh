@@ -0,0 +1,119 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nvbench::detail
+{
+
+/**
+ * Appends JSON text to a string, formatted byte-for-byte as
+ * `nlohmann::ordered_json::dump(2)` would format the same document.
+ *
+ * This lets large documents be written incrementally instead of building the
+ * whole DOM first. Keys and values must be written in document order.
+ * `depth` is the nesting depth of the first value written, for fragments of a
+ * larger document.
+ */
+struct json_writer
+{
+  explicit json_writer(std::string &out, std::size_t depth = 0)
+      : m_out{out}
+      , m_depth{depth}
+  {}
+
+  void begin_object();
+  void end_object();
+  void begin_array();
+  void end_array();
+
+  /// Starts a member of the current object. Must be followed by a value.
+  void key(std::string_view key);
+
+  void value(std::string_view value);
+  void value(const char *value) { this->value(std::string_view{value}); }
+  void value(const std::string &value) { this->value(std::string_view{value}); }
+  void value(bool value);
+  void value(std::nullptr_t);
+  void value(nvbench::float64_t value);
+
+  template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+  void value(T value)
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      this->write_int64(static_cast<std::int64_t>(value));
+    }
+    else
+    {
+      this->write_uint64(static_cast<std::uint64_t>(value));
+    }
+  }
+
+  /// `key(k)` followed by `value(v)`.
+  template <typename T>
+  void member(std::string_view k, T &&v)
+  {
+    this->key(k);
+    this->value(std::forward<T>(v));
+  }
+
+  /**
+   * Appends items to the current array that were serialized separately, at
+   * this array's depth, each preceded by `item_prefix(depth, is_first)`.
+   * `depth` is the depth of the items, i.e. the array's depth plus one.
+   * @{
+   */
+  void raw_items(std::string_view items);
+  [[nodiscard]] static std::string item_prefix(std::size_t depth, bool is_first);
+  /// @}
+
+  /// Current nesting depth.
+  [[nodiscard]] std::size_t get_depth() const { return m_depth + m_stack.size(); }
+
+private:
+  struct frame
+  {
+    bool has_members;
+  };
+
+  void begin_value();
+  void begin_container(char open);
+  void end_container(char close);
+  void newline_indent(std::size_t depth);
+  void write_string(std::string_view str);
+  void write_int64(std::int64_t value);
+  void write_uint64(std::uint64_t value);
+
+  std::string &m_out;
+  std::size_t m_depth;
+  std::vector<frame> m_stack;
+  bool m_after_key{false};
+};
+
+} // namespace nvbench::detail
@@ -0,0 +1,197 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/json_writer.cuh>
+
+#include <fmt/format.h>
+
+#include <nlohmann/json.hpp>
+
+#include <iterator>
+
+namespace nvbench::detail
+{
+
+void json_writer::begin_object() { this->begin_container('{'); }
+
+void json_writer::end_object() { this->end_container('}'); }
+
+void json_writer::begin_array() { this->begin_container('['); }
+
+void json_writer::end_array() { this->end_container(']'); }
+
+void json_writer::key(std::string_view key)
+{
+  auto &top = m_stack.back();
+  m_out += top.has_members ? "," : "";
+  top.has_members = true;
+  this->newline_indent(this->get_depth());
+  this->write_string(key);
+  m_out += ": ";
+  m_after_key = true;
+}
+
+void json_writer::value(std::string_view value)
+{
+  this->begin_value();
+  this->write_string(value);
+}
+
+void json_writer::value(bool value)
+{
+  this->begin_value();
+  m_out += value ? "true" : "false";
+}
+
+void json_writer::value(std::nullptr_t)
+{
+  this->begin_value();
+  m_out += "null";
+}
+
+void json_writer::value(nvbench::float64_t value)
+{
+  this->begin_value();
+  // nlohmann prints the shortest round-trip representation in its own style
+  // (e.g. `2.0`, `1e-05`, `null` for non-finite values). Floats are rare in
+  // NVBench's output, so defer to it:
+  m_out += nlohmann::json(value).dump();
+}
+
+void json_writer::raw_items(std::string_view items)
+{
+  m_stack.back().has_members = true;
+  m_out += items;
+}
+
+std::string json_writer::item_prefix(std::size_t depth, bool is_first)
+{
+  std::string prefix = is_first ? "\n" : ",\n";
+  prefix.append(2 * depth, ' ');
+  return prefix;
+}
+
+void json_writer::begin_value()
+{
+  if (m_after_key)
+  {
+    m_after_key = false;
+    return;
+  }
+  if (!m_stack.empty())
+  { // Array item:
+    auto &top = m_stack.back();
+    m_out += top.has_members ? "," : "";
+    top.has_members = true;
+    this->newline_indent(this->get_depth());
+  }
+}
+
+void json_writer::begin_container(char open)
+{
+  this->begin_value();
+  m_out += open;
+  m_stack.push_back({false});
+}
+
+void json_writer::end_container(char close)
+{
+  const bool has_members = m_stack.back().has_members;
+  m_stack.pop_back();
+  if (has_members)
+  {
+    this->newline_indent(this->get_depth());
+  }
+  m_out += close;
+}
+
+void json_writer::newline_indent(std::size_t depth)
+{
+  m_out += '\n';
+  m_out.append(2 * depth, ' ');
+}
+
+void json_writer::write_string(std::string_view str)
+{
+  // Fall back to nlohmann for anything but ASCII, so UTF-8 is validated and
+  // escaped exactly as before:
+  for (const char c : str)
+  {
+    if (static_cast<unsigned char>(c) >= 0x80)
+    {
+      m_out += nlohmann::json(std::string{str}).dump();
+      return;
+    }
+  }
+
+  m_out += '"';
+  for (const char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        m_out += "\\\"";
+        break;
+      case '\\':
+        m_out += "\\\\";
+        break;
+      case '\b':
+        m_out += "\\b";
+        break;
+      case '\f':
+        m_out += "\\f";
+        break;
+      case '\n':
+        m_out += "\\n";
+        break;
+      case '\r':
+        m_out += "\\r";
+        break;
+      case '\t':
+        m_out += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          fmt::format_to(std::back_inserter(m_out), "\\u{:04x}", static_cast<unsigned>(c));
+        }
+        else
+        {
+          m_out += c;
+        }
+        break;
+    }
+  }
+  m_out += '"';
+}
+
+void json_writer::write_int64(std::int64_t value)
+{
+  this->begin_value();
+  const fmt::format_int str{value};
+  m_out.append(str.data(), str.size());
+}
+
+void json_writer::write_uint64(std::uint64_t value)
+{
+  this->begin_value();
+  const fmt::format_int str{value};
+  m_out.append(str.data(), str.size());
+}
+
+} // namespace nvbench::detail
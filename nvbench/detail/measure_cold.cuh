@@ -43,10 +43,12 @@
 #include <nvbench/device_info.cuh>
 #include <nvbench/exec_tag.cuh>
 #include <nvbench/launch.cuh>
+#include <nvbench/timer_calibration.cuh>
 
+#include <nvbench/detail/convergence_criteria.cuh>
 #include <nvbench/detail/kernel_launcher_timer_wrapper.cuh>
 #include <nvbench/detail/l2flush.cuh>
-#include <nvbench/detail/ring_buffer.cuh>
+#include <nvbench/detail/outlier_filter.cuh>
 #include <nvbench/detail/statistics.cuh>
 
 #include <hip/hip_runtime.h>
@@ -80,12 +82,21 @@ protected:
   void initialize();
   void run_trials_prologue();
   void record_measurements();
+  void record_sample(nvbench::float64_t cuda_time, nvbench::float64_t cpu_time);
+  void flush_pending_samples();
   bool is_finished();
   void run_trials_epilogue();
   void generate_summaries();
 
   void check_skip_time(nvbench::float64_t warmup_time);
 
+  // Confidence interval of the mean GPU time, used for the optional
+  // `max_ci_half_width` stopping criterion and summaries. Bootstrapped when
+  // that criterion is enabled, else a normal approximation (O(1)).
+  static constexpr nvbench::float64_t ci_confidence = 0.95;
+  static constexpr std::size_t ci_resamples         = 1000;
+  [[nodiscard]] statistics::confidence_interval<nvbench::float64_t> compute_mean_ci() const;
+
   __forceinline__ void flush_device_l2() { m_l2flush.flush(m_launch.get_stream()); }
 
   __forceinline__ void sync_stream() const
@@ -107,26 +118,40 @@ protected:
 
   bool m_run_once{false};
   bool m_no_block{false};
+  bool m_streaming_percentiles{false};
+  bool m_subtract_timer_overhead{false};
 
-  nvbench::int64_t m_min_samples{};
-  nvbench::float64_t m_max_noise{}; // rel stdev
-  nvbench::float64_t m_min_time{};
-
+  nvbench::detail::convergence_criteria m_convergence;
+  nvbench::float64_t m_max_ci_half_width{}; // rel CI half-width
   nvbench::float64_t m_skip_time{};
-  nvbench::float64_t m_timeout{};
+
+  nvbench::timer_calibration m_timer_calibration{};
 
   nvbench::int64_t m_total_samples{};
   nvbench::float64_t m_total_cuda_time{};
   nvbench::float64_t m_total_cpu_time{};
   nvbench::float64_t m_cpu_noise{}; // rel stdev
+  nvbench::float64_t m_ci_half_width{}; // rel CI half-width at the last check
+  nvbench::int64_t m_next_ci_check{};
+
+  // Streaming statistics over m_cuda_times, updated once per sample
+  nvbench::detail::statistics::running_statistics<nvbench::float64_t> m_cuda_time_stats;
+  nvbench::detail::statistics::running_statistics<nvbench::float64_t> m_cpu_time_stats;
 
-  // Trailing history of noise measurements for convergence tests
-  nvbench::detail::ring_buffer<nvbench::float64_t> m_noise_tracker{512};
+  // Percentile sketches used instead of m_cuda_times / m_cpu_times when
+  // m_streaming_percentiles is set.
+  nvbench::detail::statistics::streaming_percentiles<nvbench::float64_t> m_cuda_time_sketch;
+  nvbench::detail::statistics::streaming_percentiles<nvbench::float64_t> m_cpu_time_sketch;
 
   std::vector<nvbench::float64_t> m_cuda_times;
   std::vector<nvbench::float64_t> m_cpu_times;
 
-  bool m_max_time_exceeded{};
+  // Rejects outlier samples before they reach the statistics above. Samples
+  // are held in m_pending_samples (cuda, cpu) until the filter has enough
+  // history to compute its fences.
+  nvbench::detail::outlier_filter m_outlier_filter;
+  std::vector<std::pair<nvbench::float64_t, nvbench::float64_t>> m_pending_samples;
+  nvbench::int64_t m_rejected_samples{};
 };
 
 template <bool use_blocking_kernel>
@@ -0,0 +1,167 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/cpu_timer.cuh>
+#include <nvbench/exec_tag.cuh>
+#include <nvbench/launch.cuh>
+#include <nvbench/timer_calibration.cuh>
+#include <nvbench/types.cuh>
+
+#include <nvbench/detail/convergence_criteria.cuh>
+#include <nvbench/detail/kernel_launcher_timer_wrapper.cuh>
+#include <nvbench/detail/statistics.cuh>
+
+#include <utility>
+#include <vector>
+
+namespace nvbench
+{
+
+struct state;
+
+namespace detail
+{
+
+// non-templated code goes here:
+struct measure_cpu_base
+{
+  explicit measure_cpu_base(nvbench::state &exec_state);
+  measure_cpu_base(const measure_cpu_base &)            = delete;
+  measure_cpu_base(measure_cpu_base &&)                 = delete;
+  measure_cpu_base &operator=(const measure_cpu_base &) = delete;
+  measure_cpu_base &operator=(measure_cpu_base &&)      = delete;
+
+protected:
+  struct kernel_launch_timer;
+
+  void initialize();
+  void run_trials_prologue();
+  void record_measurements();
+  bool is_finished();
+  void run_trials_epilogue();
+  void generate_summaries();
+
+  void check_skip_time(nvbench::float64_t warmup_time);
+
+  nvbench::state &m_state;
+
+  nvbench::launch m_launch;
+  nvbench::cpu_timer m_cpu_timer;
+  nvbench::cpu_timer m_walltime_timer;
+
+  bool m_run_once{false};
+  bool m_streaming_percentiles{false};
+  bool m_subtract_timer_overhead{false};
+
+  nvbench::detail::convergence_criteria m_convergence;
+  nvbench::float64_t m_skip_time{};
+
+  nvbench::timer_calibration m_timer_calibration{};
+
+  nvbench::int64_t m_total_samples{};
+  nvbench::float64_t m_total_cpu_time{};
+
+  // Streaming statistics over m_cpu_times, updated once per sample
+  nvbench::detail::statistics::running_statistics<nvbench::float64_t> m_cpu_time_stats;
+
+  // Used instead of m_cpu_times when m_streaming_percentiles is set.
+  nvbench::detail::statistics::streaming_percentiles<nvbench::float64_t> m_cpu_time_sketch;
+
+  std::vector<nvbench::float64_t> m_cpu_times;
+};
+
+struct measure_cpu_base::kernel_launch_timer
+{
+  explicit kernel_launch_timer(measure_cpu_base &measure)
+      : m_measure{measure}
+  {}
+
+  __forceinline__ void start() { m_measure.m_cpu_timer.start(); }
+
+  __forceinline__ void stop() { m_measure.m_cpu_timer.stop(); }
+
+private:
+  measure_cpu_base &m_measure;
+};
+
+/**
+ * Measures the host execution time of a `KernelLauncher`.
+ *
+ * Only a `cpu_timer` is used, so no device or stream is required. Any device
+ * work launched by the `KernelLauncher` must be complete before it returns
+ * for the results to be meaningful.
+ */
+template <typename KernelLauncher>
+struct measure_cpu : public measure_cpu_base
+{
+  measure_cpu(nvbench::state &state, KernelLauncher &kernel_launcher)
+      : measure_cpu_base(state)
+      , m_kernel_launcher{kernel_launcher}
+  {}
+
+  void operator()()
+  {
+    this->initialize();
+    this->run_warmup();
+
+    this->run_trials_prologue();
+    this->run_trials();
+    this->run_trials_epilogue();
+
+    this->generate_summaries();
+  }
+
+private:
+  // Run the launcher once, measuring the CPU time. If under skip_time, skip
+  // the measurement.
+  void run_warmup()
+  {
+    if (m_run_once)
+    { // Skip warmups
+      return;
+    }
+
+    kernel_launch_timer timer(*this);
+
+    this->launch_kernel(timer);
+    this->check_skip_time(m_cpu_timer.get_duration());
+  }
+
+  void run_trials()
+  {
+    kernel_launch_timer timer(*this);
+    do
+    {
+      this->launch_kernel(timer);
+      this->record_measurements();
+    } while (!this->is_finished());
+  }
+
+  template <typename TimerT>
+  __forceinline__ void launch_kernel(TimerT &timer)
+  {
+    m_kernel_launcher(m_launch, timer);
+  }
+
+  KernelLauncher &m_kernel_launcher;
+};
+
+} // namespace detail
+} // namespace nvbench
@@ -0,0 +1,228 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/measure_cpu.cuh>
+
+#include <nvbench/benchmark_base.cuh>
+#include <nvbench/device_manager.cuh>
+#include <nvbench/printer_base.cuh>
+#include <nvbench/state.cuh>
+#include <nvbench/summary.cuh>
+
+#include <nvbench/detail/percentile_summaries.cuh>
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace nvbench::detail
+{
+
+measure_cpu_base::measure_cpu_base(state &exec_state)
+    : m_state{exec_state}
+    , m_launch{m_state.get_cuda_stream()}
+    , m_run_once{exec_state.get_run_once()}
+    , m_streaming_percentiles{exec_state.get_streaming_percentiles()}
+    , m_subtract_timer_overhead{exec_state.get_subtract_timer_overhead()}
+    , m_convergence{exec_state}
+    , m_skip_time{exec_state.get_skip_time()}
+{}
+
+void measure_cpu_base::initialize()
+{
+  m_timer_calibration = nvbench::device_manager::get().get_host_timer_calibration();
+
+  m_total_cpu_time = 0.;
+  m_total_samples  = 0;
+  m_cpu_time_stats.clear();
+  m_cpu_time_sketch.clear();
+  m_convergence.clear();
+  m_cpu_times.clear();
+}
+
+void measure_cpu_base::run_trials_prologue() { m_walltime_timer.start(); }
+
+void measure_cpu_base::record_measurements()
+{
+  // Update and record timers and counters:
+  auto cur_cpu_time = m_cpu_timer.get_duration();
+  if (m_subtract_timer_overhead)
+  {
+    cur_cpu_time = std::max(cur_cpu_time - m_timer_calibration.cpu_timer_overhead, 0.);
+  }
+  if (m_streaming_percentiles)
+  {
+    m_cpu_time_sketch.add(cur_cpu_time);
+  }
+  else
+  {
+    m_cpu_times.push_back(cur_cpu_time);
+  }
+  m_total_cpu_time += cur_cpu_time;
+  ++m_total_samples;
+
+  // Compute convergence statistics using CPU timings:
+  m_cpu_time_stats.add(cur_cpu_time);
+  const auto mean_cpu_time = m_total_cpu_time / static_cast<nvbench::float64_t>(m_total_samples);
+  m_convergence.add_noise(m_cpu_time_stats.standard_deviation() / mean_cpu_time);
+}
+
+bool measure_cpu_base::is_finished()
+{
+  if (m_run_once)
+  {
+    return true;
+  }
+
+  return m_convergence.is_finished(m_total_cpu_time, m_total_samples, m_walltime_timer);
+}
+
+void measure_cpu_base::run_trials_epilogue() { m_walltime_timer.stop(); }
+
+void measure_cpu_base::generate_summaries()
+{
+  const auto d_samples = static_cast<double>(m_total_samples);
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/cpu/sample_size",
+                                     "Samples",
+                                     "sample_size",
+                                     "Number of host-timed executions");
+    m_state.add_summary(schema).set_int64("value", m_total_samples);
+  }
+
+  const auto avg_cpu_time = m_total_cpu_time / d_samples;
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/cpu/time/mean",
+                                     "CPU Time",
+                                     "duration",
+                                     "Mean execution time (measured on host CPU)");
+    m_state.add_summary(schema).set_float64("value", avg_cpu_time);
+  }
+
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/cpu/time/stdev/relative",
+                                     "Noise",
+                                     "percentage",
+                                     "Relative standard deviation of host-timed executions");
+    m_state.add_summary(schema).set_float64("value", m_convergence.get_noise());
+  }
+
+  {
+    static const auto schemas = intern_percentile_schemas("nv/cpu/time",
+                                                          "CPU",
+                                                          "execution time (measured on host CPU)",
+                                                          false);
+    add_percentile_summaries(m_state,
+                             schemas,
+                             m_streaming_percentiles
+                               ? m_cpu_time_sketch.get()
+                               : statistics::compute_percentile_summary(m_cpu_times));
+  }
+
+  if (const auto items = m_state.get_element_count(); items != 0)
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/cpu/bw/item_rate",
+                                     "Elem/s",
+                                     "item_rate",
+                                     "Number of input elements processed per second");
+    m_state.add_summary(schema).set_float64("value", static_cast<double>(items) / avg_cpu_time);
+  }
+
+  if (const auto bytes = m_state.get_global_memory_rw_bytes(); bytes != 0)
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/cpu/bw/bytes_per_second",
+                                     "Mem BW",
+                                     "byte_rate",
+                                     "Number of bytes read/written per second");
+    m_state.add_summary(schema).set_float64("value", static_cast<double>(bytes) / avg_cpu_time);
+  }
+
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/calibration/cpu_timer/overhead",
+                                     "CPU Timer Overhead",
+                                     "duration",
+                                     "CPU time of an empty timed region",
+                                     "Hidden by default.");
+    static const auto &subtracted_schema = summary_registry::get().intern(
+      "nv/calibration/cpu_timer/overhead",
+      "CPU Timer Overhead",
+      "duration",
+      "CPU time of an empty timed region (subtracted from each sample)",
+      "Hidden by default.");
+    m_state.add_summary(m_subtract_timer_overhead ? subtracted_schema : schema)
+      .set_float64("value", m_timer_calibration.cpu_timer_overhead);
+  }
+
+  {
+    static const auto &schema =
+      summary_registry::get().intern("nv/cpu/walltime",
+                                     "Walltime",
+                                     "duration",
+                                     "Walltime used for host-timed measurements",
+                                     "Hidden by default.");
+    m_state.add_summary(schema).set_float64("value", m_walltime_timer.get_duration());
+  }
+
+  // Log if a printer exists:
+  if (auto printer_opt_ref = m_state.get_benchmark().get_printer(); printer_opt_ref.has_value())
+  {
+    auto &printer = printer_opt_ref.value().get();
+
+    m_convergence.log_timeout_warnings(printer,
+                                       m_walltime_timer.get_duration(),
+                                       m_total_cpu_time,
+                                       m_total_samples);
+
+    // Log to stdout:
+    printer.log(nvbench::log_level::pass,
+                fmt::format("CPU: {:0.6f}ms mean, {:0.2f}s total CPU, {:0.2f}s total wall, {}x ",
+                            avg_cpu_time * 1e3,
+                            m_total_cpu_time,
+                            m_walltime_timer.get_duration(),
+                            m_total_samples));
+
+    if (!m_streaming_percentiles)
+    {
+      printer.process_bulk_data(m_state, "nv/cpu/sample_times", "sample_times", m_cpu_times);
+    }
+  }
+}
+
+void measure_cpu_base::check_skip_time(nvbench::float64_t warmup_time)
+{
+  if (m_skip_time > 0. && warmup_time < m_skip_time)
+  {
+    auto reason = fmt::format("Warmup time did not meet skip_time limit: "
+                              "{:0.3f}us < {:0.3f}us.",
+                              warmup_time * 1e6,
+                              m_skip_time * 1e6);
+
+    m_state.skip(reason);
+    NVBENCH_THROW(std::runtime_error, "{}", std::move(reason));
+  }
+}
+
+} // namespace nvbench::detail
@@ -43,9 +43,13 @@
 #include <nvbench/exec_tag.cuh>
 #include <nvbench/launch.cuh>
 
+#include <nvbench/detail/convergence_criteria.cuh>
+#include <nvbench/detail/statistics.cuh>
+
 #include <hip/hip_runtime.h>
 
 #include <utility>
+#include <vector>
 
 namespace nvbench
 {
@@ -65,15 +69,24 @@ struct measure_hot_base
   measure_hot_base &operator=(measure_hot_base &&)      = delete;
 
 protected:
+  // The steady-state batch size targets this many batches per min_time:
+  static constexpr nvbench::int64_t target_batch_count = 32;
+
   void check();
 
   void initialize()
   {
-    m_total_cuda_time   = 0.;
-    m_total_samples     = 0;
-    m_max_time_exceeded = false;
+    m_total_cuda_time = 0.;
+    m_total_samples   = 0;
+    m_batch_time_stats.clear();
+    m_convergence.clear();
+    m_batch_times.clear();
   }
 
+  void run_trials_prologue();
+  void record_batch();
+  bool is_finished();
+  void run_trials_epilogue();
   void generate_summaries();
 
   void check_skip_time(nvbench::float64_t warmup_time);
@@ -89,16 +102,24 @@ protected:
   nvbench::cpu_timer m_walltime_timer;
   nvbench::blocking_kernel m_blocker;
 
-  nvbench::int64_t m_min_samples{};
-  nvbench::float64_t m_min_time{};
-
+  nvbench::detail::convergence_criteria m_convergence;
   nvbench::float64_t m_skip_time{};
-  nvbench::float64_t m_timeout{};
+
+  // Batches start small and double in size until they take about
+  // m_batch_target_time. These ramp batches only calibrate the batch size and
+  // are not included in the results.
+  bool m_ramping{true};
+  nvbench::int64_t m_batch_size{1};
+  nvbench::float64_t m_batch_target_time{};
 
   nvbench::int64_t m_total_samples{};
   nvbench::float64_t m_total_cuda_time{};
 
-  bool m_max_time_exceeded{false};
+  // Streaming statistics over m_batch_times, updated once per batch
+  nvbench::detail::statistics::running_statistics<nvbench::float64_t> m_batch_time_stats;
+
+  // Mean time per kernel execution in each recorded batch
+  std::vector<nvbench::float64_t> m_batch_times;
 };
 
 template <typename KernelLauncher, bool use_blocking_kernel>
@@ -143,79 +164,55 @@ private:
 
   void run_trials()
   {
-    m_walltime_timer.start();
-
-    // Use warmup results to estimate the number of iterations to run.
-    // The .95 factor here pads the batch_size a bit to avoid needing a second
-    // batch due to noise.
-    const auto time_estimate = m_cuda_timer.get_duration() * 0.95;
-    auto batch_size          = static_cast<nvbench::int64_t>(m_min_time / time_estimate);
-
+    this->run_trials_prologue();
     do
     {
-      batch_size = std::max(batch_size, nvbench::int64_t{1});
-
-      if constexpr (use_blocking_kernel)
-      {
-        // Block stream until some work is queued.
-        // Limit the number of kernel executions while blocked to prevent
-        // deadlocks. See warnings on blocking_kernel.
-        const auto blocked_launches   = std::min(batch_size, nvbench::int64_t{2});
-        const auto unblocked_launches = batch_size - blocked_launches;
-
-        this->block_stream();
-        m_cuda_timer.start(m_launch.get_stream());
-
-        for (nvbench::int64_t i = 0; i < blocked_launches; ++i)
-        {
-          // If your benchmark deadlocks in the next launch, reduce the size of
-          // blocked_launches. See note above.
-          this->launch_kernel();
-        }
-
-        this->unblock_stream(); // Start executing earlier launches
-
-        for (nvbench::int64_t i = 0; i < unblocked_launches; ++i)
-        {
-          this->launch_kernel();
-        }
-      }
-      else
-      {
-        m_cuda_timer.start(m_launch.get_stream());
+      this->run_batch(m_batch_size);
+      this->record_batch();
+    } while (!this->is_finished());
+    this->run_trials_epilogue();
+  }
 
-        for (nvbench::int64_t i = 0; i < batch_size; ++i)
-        {
-          this->launch_kernel();
-        }
-      }
+  // Launch the kernel `batch_size` times, measuring the total GPU time.
+  void run_batch(nvbench::int64_t batch_size)
+  {
+    if constexpr (use_blocking_kernel)
+    {
+      // Block stream until some work is queued.
+      // Limit the number of kernel executions while blocked to prevent
+      // deadlocks. See warnings on blocking_kernel.
+      const auto blocked_launches   = std::min(batch_size, nvbench::int64_t{2});
+      const auto unblocked_launches = batch_size - blocked_launches;
 
-      m_cuda_timer.stop(m_launch.get_stream());
-      this->sync_stream();
+      this->block_stream();
+      m_cuda_timer.start(m_launch.get_stream());
 
-      m_total_cuda_time += m_cuda_timer.get_duration();
-      m_total_samples += batch_size;
+      for (nvbench::int64_t i = 0; i < blocked_launches; ++i)
+      {
+        // If your benchmark deadlocks in the next launch, reduce the size of
+        // blocked_launches. See note above.
+        this->launch_kernel();
+      }
 
-      // Predict number of remaining iterations:
-      batch_size = static_cast<nvbench::int64_t>(
-        (m_min_time - m_total_cuda_time) /
-        (m_total_cuda_time / static_cast<nvbench::float64_t>(m_total_samples)));
+      this->unblock_stream(); // Start executing earlier launches
 
-      if (m_total_cuda_time > m_min_time && // min time okay
-          m_total_samples > m_min_samples)  // min samples okay
+      for (nvbench::int64_t i = 0; i < unblocked_launches; ++i)
       {
-        break; // Stop iterating
+        this->launch_kernel();
       }
+    }
+    else
+    {
+      m_cuda_timer.start(m_launch.get_stream());
 
-      m_walltime_timer.stop();
-      if (m_walltime_timer.get_duration() > m_timeout)
+      for (nvbench::int64_t i = 0; i < batch_size; ++i)
       {
-        m_max_time_exceeded = true;
-        break;
+        this->launch_kernel();
       }
-    } while (true);
+    }
 
-    m_walltime_timer.stop();
+    m_cuda_timer.stop(m_launch.get_stream());
+    this->sync_stream();
   }
 
   __forceinline__ void launch_kernel() { m_kernel_launcher(m_launch); }
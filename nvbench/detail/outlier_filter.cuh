@@ -0,0 +1,161 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/outlier_policy.cuh>
+#include <nvbench/types.cuh>
+
+#include <nvbench/detail/ring_buffer.cuh>
+#include <nvbench/detail/statistics.cuh>
+#include <nvbench/detail/throw.cuh>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace nvbench::detail
+{
+
+/**
+ * Classifies samples as outliers using robust fences computed from a trailing
+ * window of recent samples. See `nvbench::outlier_policy` for the available
+ * policies.
+ *
+ * Fences become available once `min_reference_size` samples have been
+ * observed, and are recomputed every `refresh_interval` observations, so the
+ * amortized cost per sample is O(window_size / refresh_interval).
+ *
+ * If the reference window has no spread (e.g. most timings are identical),
+ * no samples are rejected until it does.
+ */
+struct outlier_filter
+{
+  static constexpr std::size_t window_size        = 512;
+  static constexpr std::size_t min_reference_size = 32;
+  static constexpr std::size_t refresh_interval   = 32;
+
+  outlier_filter(nvbench::outlier_policy policy, nvbench::float64_t threshold)
+      : m_policy{policy}
+      , m_threshold{threshold}
+  {
+    NVBENCH_THROW_IF(m_policy != nvbench::outlier_policy::none && !(m_threshold > 0.),
+                     std::runtime_error,
+                     "Outlier threshold must be positive (got {}).",
+                     m_threshold);
+  }
+
+  void clear()
+  {
+    m_window.clear();
+    m_since_refresh = 0;
+    m_ready         = false;
+    m_lower         = -std::numeric_limits<nvbench::float64_t>::infinity();
+    m_upper         = std::numeric_limits<nvbench::float64_t>::infinity();
+  }
+
+  [[nodiscard]] nvbench::outlier_policy get_policy() const { return m_policy; }
+  [[nodiscard]] nvbench::float64_t get_threshold() const { return m_threshold; }
+
+  [[nodiscard]] bool is_enabled() const { return m_policy != nvbench::outlier_policy::none; }
+
+  /// True once enough samples have been observed to compute fences.
+  [[nodiscard]] bool is_ready() const { return m_ready; }
+
+  [[nodiscard]] nvbench::float64_t get_lower_fence() const { return m_lower; }
+  [[nodiscard]] nvbench::float64_t get_upper_fence() const { return m_upper; }
+
+  /// Add a sample to the reference window, refreshing the fences if needed.
+  void observe(nvbench::float64_t val)
+  {
+    if (!this->is_enabled())
+    {
+      return;
+    }
+
+    m_window.push_back(val);
+    ++m_since_refresh;
+    if (m_window.size() >= min_reference_size &&
+        (!m_ready || m_since_refresh >= refresh_interval))
+    {
+      this->refresh();
+    }
+  }
+
+  [[nodiscard]] bool is_outlier(nvbench::float64_t val) const
+  {
+    return m_ready && (val < m_lower || val > m_upper);
+  }
+
+private:
+  void refresh()
+  {
+    m_scratch.assign(m_window.cbegin(), m_window.cend());
+    const auto first = m_scratch.begin();
+    const auto last  = m_scratch.end();
+
+    nvbench::float64_t center{};
+    nvbench::float64_t spread{};
+    nvbench::float64_t lower{};
+    nvbench::float64_t upper{};
+    if (m_policy == nvbench::outlier_policy::mad)
+    {
+      center = statistics::percentile(first, last, 0.5);
+      std::transform(first, last, first, [center](auto v) { return std::abs(v - center); });
+      // Scale so that the spread estimates the stdev of normally distributed data:
+      spread = 1.4826 * statistics::percentile(first, last, 0.5);
+      lower  = center;
+      upper  = center;
+    }
+    else // iqr
+    {
+      lower  = statistics::percentile(first, last, 0.25);
+      upper  = statistics::percentile(first, last, 0.75);
+      spread = upper - lower;
+    }
+
+    if (spread > 0.)
+    {
+      m_lower = lower - m_threshold * spread;
+      m_upper = upper + m_threshold * spread;
+    }
+    else
+    {
+      m_lower = -std::numeric_limits<nvbench::float64_t>::infinity();
+      m_upper = std::numeric_limits<nvbench::float64_t>::infinity();
+    }
+    m_since_refresh = 0;
+    m_ready         = true;
+  }
+
+  nvbench::outlier_policy m_policy;
+  nvbench::float64_t m_threshold;
+
+  nvbench::detail::ring_buffer<nvbench::float64_t> m_window{window_size};
+  std::vector<nvbench::float64_t> m_scratch;
+  std::size_t m_since_refresh{};
+  bool m_ready{false};
+
+  nvbench::float64_t m_lower{-std::numeric_limits<nvbench::float64_t>::infinity()};
+  nvbench::float64_t m_upper{std::numeric_limits<nvbench::float64_t>::infinity()};
+};
+
+} // namespace nvbench::detail
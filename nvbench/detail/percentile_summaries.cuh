@@ -0,0 +1,64 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <nvbench/detail/statistics.cuh>
+
+#include <array>
+#include <string>
+
+namespace nvbench
+{
+
+struct state;
+struct summary_schema;
+
+namespace detail
+{
+
+/// Schemas of the `<tag_prefix>/{min,median,p90,p99,max}` summaries, in that
+/// order.
+using percentile_schemas = std::array<const nvbench::summary_schema *, 5>;
+
+/**
+ * Interns the schemas of the `<tag_prefix>/{min,median,p90,p99,max}` duration
+ * summaries. Call sites should do this once and keep the result:
+ *
+ * ```
+ * static const auto schemas = intern_percentile_schemas(...);
+ * ```
+ *
+ * `label` is appended to the column names (e.g. "Median GPU") and `source`
+ * completes the descriptions (e.g. "isolated kernel execution time"). If
+ * `hide` is true, the summaries are only written to machine-readable output.
+ */
+[[nodiscard]] percentile_schemas intern_percentile_schemas(const std::string &tag_prefix,
+                                                           const std::string &label,
+                                                           const std::string &source,
+                                                           bool hide);
+
+/// Adds the summaries of `schemas` to `state`, holding `values`.
+void add_percentile_summaries(nvbench::state &state,
+                              const percentile_schemas &schemas,
+                              const statistics::percentile_summary<nvbench::float64_t> &values);
+
+} // namespace detail
+} // namespace nvbench
@@ -0,0 +1,76 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/percentile_summaries.cuh>
+
+#include <nvbench/state.cuh>
+#include <nvbench/summary.cuh>
+#include <nvbench/summary_registry.cuh>
+
+#include <fmt/format.h>
+
+namespace nvbench::detail
+{
+
+percentile_schemas intern_percentile_schemas(const std::string &tag_prefix,
+                                             const std::string &label,
+                                             const std::string &source,
+                                             bool hide)
+{
+  struct entry
+  {
+    const char *suffix;
+    const char *name;
+    const char *description;
+  };
+
+  constexpr entry entries[] = {{"min", "Min", "Minimum"},
+                               {"median", "Median", "Median"},
+                               {"p90", "P90", "90th percentile"},
+                               {"p99", "P99", "99th percentile"},
+                               {"max", "Max", "Maximum"}};
+
+  percentile_schemas schemas{};
+  for (std::size_t i = 0; i < schemas.size(); ++i)
+  {
+    const auto &e = entries[i];
+    schemas[i]    = &summary_registry::get().intern(fmt::format("{}/{}", tag_prefix, e.suffix),
+                                                    fmt::format("{} {}", e.name, label),
+                                                    "duration",
+                                                    fmt::format("{} {}", e.description, source),
+                                                    hide ? "Hidden by default." : "");
+  }
+  return schemas;
+}
+
+void add_percentile_summaries(nvbench::state &state,
+                              const percentile_schemas &schemas,
+                              const statistics::percentile_summary<nvbench::float64_t> &values)
+{
+  const nvbench::float64_t percentiles[] = {values.min,
+                                            values.median,
+                                            values.p90,
+                                            values.p99,
+                                            values.max};
+  for (std::size_t i = 0; i < schemas.size(); ++i)
+  {
+    state.add_summary(*schemas[i]).set_float64("value", percentiles[i]);
+  }
+}
+
+} // namespace nvbench::detail
@@ -41,7 +41,12 @@
 
 #include <nvbench/detail/statistics.cuh>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
 namespace nvbench::detail
@@ -49,10 +54,19 @@ namespace nvbench::detail
 
 /**
  * @brief A simple, dynamically sized ring buffer.
+ *
+ * If `TrackStatistics` is true, running sums of the values in the buffer are
+ * updated as values are pushed and evicted, so that `mean()` and
+ * `standard_deviation()` over the current window are O(1). The sums are
+ * recomputed from the buffer contents once per `capacity()` pushes to bound
+ * the accumulated floating point error.
  */
-template <typename T>
+template <typename T, bool TrackStatistics = false>
 struct ring_buffer
 {
+  static_assert(!TrackStatistics || std::is_floating_point_v<T>,
+                "Statistics are only supported for floating point values.");
+
   /**
    * Create a new ring buffer with the requested capacity.
    */
@@ -96,6 +110,11 @@ struct ring_buffer
   {
     m_index = 0;
     m_full  = false;
+
+    m_shift             = T{};
+    m_shifted_sum       = T{};
+    m_shifted_sum_sq    = T{};
+    m_pushes_since_sync = 0;
   }
 
   /**
@@ -106,6 +125,19 @@ struct ring_buffer
   {
     assert(m_index < m_buffer.size());
 
+    if constexpr (TrackStatistics)
+    {
+      if (m_full)
+      { // Evict the value that is about to be overwritten:
+        const T old = m_buffer[m_index] - m_shift;
+        m_shifted_sum -= old;
+        m_shifted_sum_sq -= old * old;
+      }
+      const T cur = val - m_shift;
+      m_shifted_sum += cur;
+      m_shifted_sum_sq += cur * cur;
+    }
+
     m_buffer[m_index] = val;
 
     m_index = (m_index + 1) % m_buffer.size();
@@ -113,6 +145,14 @@ struct ring_buffer
     { // buffer wrapped
       m_full = true;
     }
+
+    if constexpr (TrackStatistics)
+    {
+      if (++m_pushes_since_sync >= m_buffer.size())
+      {
+        this->sync_statistics();
+      }
+    }
   }
 
   /**
@@ -133,10 +173,72 @@ struct ring_buffer
   }
   /**@}*/
 
+  /**
+   * The mean of the values currently in the buffer.
+   * Requires `TrackStatistics`.
+   */
+  [[nodiscard]] T mean() const
+  {
+    static_assert(TrackStatistics, "ring_buffer does not track statistics.");
+    assert(!this->empty());
+    return m_shift + m_shifted_sum / static_cast<T>(this->size());
+  }
+
+  /**
+   * The unbiased sample standard deviation of the values currently in the
+   * buffer, measured from `mean`. Equivalent to calling
+   * `nvbench::detail::statistics::standard_deviation` over the buffer, and
+   * likewise returns infinity for fewer than 5 values.
+   * Requires `TrackStatistics`.
+   * @{
+   */
+  [[nodiscard]] T standard_deviation() const { return this->standard_deviation(this->mean()); }
+  [[nodiscard]] T standard_deviation(T mean) const
+  {
+    static_assert(TrackStatistics, "ring_buffer does not track statistics.");
+
+    const auto num = this->size();
+    if (num < 5) // don't bother with low sample sizes.
+    {
+      return std::numeric_limits<T>::infinity();
+    }
+
+    // sum((x - mean)^2) expanded around the current shift:
+    const T offset   = mean - m_shift;
+    const T sum_sq   = m_shifted_sum_sq - T{2} * offset * m_shifted_sum +
+                     static_cast<T>(num) * offset * offset;
+    const T variance = std::max(sum_sq, T{}) / static_cast<T>(num - 1);
+    return std::sqrt(variance);
+  }
+  /**@}*/
+
 private:
+  // Recompute the running sums from scratch, shifting the values by their
+  // current mean to reduce cancellation in the sum of squares.
+  void sync_statistics()
+  {
+    m_pushes_since_sync = 0;
+
+    const auto num   = static_cast<T>(this->size());
+    m_shift          = std::accumulate(this->cbegin(), this->cend(), T{}) / num;
+    m_shifted_sum    = T{};
+    m_shifted_sum_sq = T{};
+    std::for_each(this->cbegin(), this->cend(), [this](T val) {
+      val -= m_shift;
+      m_shifted_sum += val;
+      m_shifted_sum_sq += val * val;
+    });
+  }
+
   std::vector<T> m_buffer;
   std::size_t m_index{0};
   bool m_full{false};
+
+  // Only used with TrackStatistics:
+  T m_shift{};
+  T m_shifted_sum{};
+  T m_shifted_sum_sq{};
+  std::size_t m_pushes_since_sync{};
 };
 
 } // namespace nvbench::detail
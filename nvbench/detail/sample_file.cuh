@@ -0,0 +1,57 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <string>
+#include <vector>
+
+namespace nvbench::detail
+{
+
+/// Element type of a `--jsonbin` sample file.
+enum class sample_file_type
+{
+  float32,
+  float64
+};
+
+[[nodiscard]] const char *to_string(sample_file_type type);
+
+/**
+ * Converts `data` to little-endian values of `type` in one pass, returning a
+ * pointer to `size` bytes. The result may point into `data` itself (when no
+ * conversion is needed) or into `scratch`, which is reused across calls.
+ */
+[[nodiscard]] const char *encode_samples(const std::vector<nvbench::float64_t> &data,
+                                         sample_file_type type,
+                                         std::vector<char> &scratch,
+                                         std::size_t &size);
+
+/**
+ * Writes `data` to `path` as little-endian values of `type` with a single
+ * write. Throws on failure.
+ */
+void write_sample_file(const std::string &path,
+                       const std::vector<nvbench::float64_t> &data,
+                       sample_file_type type,
+                       std::vector<char> &scratch);
+
+} // namespace nvbench::detail
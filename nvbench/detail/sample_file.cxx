@@ -0,0 +1,142 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/sample_file.cuh>
+
+#include <nvbench/config.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+#if NVBENCH_CPP_DIALECT >= 2020
+#include <bit>
+#endif
+
+namespace
+{
+
+bool is_little_endian()
+{
+#if NVBENCH_CPP_DIALECT >= 2020
+  return std::endian::native == std::endian::little;
+#else
+  const nvbench::uint32_t word = {0xBadDecaf};
+  nvbench::uint8_t bytes[4];
+  std::memcpy(bytes, &word, 4);
+  return bytes[0] == 0xaf;
+#endif
+}
+
+template <std::size_t Size>
+void swap_bytes(char *data, std::size_t size)
+{
+  for (char *value = data; value < data + size; value += Size)
+  {
+    std::reverse(value, value + Size);
+  }
+}
+
+} // namespace
+
+namespace nvbench::detail
+{
+
+const char *to_string(sample_file_type type)
+{
+  switch (type)
+  {
+    case sample_file_type::float32:
+      return "float32";
+    case sample_file_type::float64:
+      return "float64";
+  }
+  return "unknown";
+}
+
+const char *encode_samples(const std::vector<nvbench::float64_t> &data,
+                           sample_file_type type,
+                           std::vector<char> &scratch,
+                           std::size_t &size)
+{
+  // the c++17 implementation of is_little_endian isn't constexpr, but
+  // all supported compilers optimize these branches as if it were.
+  if (type == sample_file_type::float64)
+  {
+    size = data.size() * sizeof(nvbench::float64_t);
+    if (is_little_endian())
+    { // Already in the file's format:
+      return reinterpret_cast<const char *>(data.data());
+    }
+    scratch.resize(size);
+    std::memcpy(scratch.data(), data.data(), size);
+    swap_bytes<sizeof(nvbench::float64_t)>(scratch.data(), size);
+    return scratch.data();
+  }
+
+  size = data.size() * sizeof(nvbench::float32_t);
+  scratch.resize(size);
+  // Hoisted so the char stores below can't alias them, which lets the loop
+  // compile to packed conversions:
+  const nvbench::float64_t *in = data.data();
+  const std::size_t count      = data.size();
+  char *out                    = scratch.data();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const auto value32 = static_cast<nvbench::float32_t>(in[i]);
+    std::memcpy(out + i * sizeof(value32), &value32, sizeof(value32));
+  }
+  if (!is_little_endian())
+  {
+    swap_bytes<sizeof(nvbench::float32_t)>(scratch.data(), size);
+  }
+  return scratch.data();
+}
+
+void write_sample_file(const std::string &path,
+                       const std::vector<nvbench::float64_t> &data,
+                       sample_file_type type,
+                       std::vector<char> &scratch)
+{
+  std::size_t size{};
+  const char *bytes = encode_samples(data, type, scratch, size);
+
+  std::unique_ptr<std::FILE, int (*)(std::FILE *)> file{std::fopen(path.c_str(), "wb"),
+                                                         &std::fclose};
+  if (!file)
+  {
+    NVBENCH_THROW(std::runtime_error, "Failed to open '{}' for writing.", path);
+  }
+  // The file is written in one call, so stdio's buffer would only add a copy:
+  std::setvbuf(file.get(), nullptr, _IONBF, 0);
+  if (std::fwrite(bytes, 1, size, file.get()) != size)
+  {
+    NVBENCH_THROW(std::runtime_error, "Failed to write {} bytes to '{}'.", size, path);
+  }
+  if (std::fclose(file.release()) != 0)
+  {
+    NVBENCH_THROW(std::runtime_error, "Failed to close '{}'.", path);
+  }
+}
+
+} // namespace nvbench::detail
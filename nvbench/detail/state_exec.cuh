@@ -48,6 +48,7 @@
 
 #include <nvbench/detail/kernel_launcher_timer_wrapper.cuh>
 #include <nvbench/detail/measure_cold.cuh>
+#include <nvbench/detail/measure_cpu.cuh>
 #include <nvbench/detail/measure_hot.cuh>
 
 #include <type_traits>
@@ -67,11 +68,20 @@ void state::exec(ExecTags tags, KernelLauncher &&kernel_launcher)
   constexpr auto measure_tags  = tags & measure_mask;
   constexpr auto modifier_tags = tags & modifier_mask;
 
-  // "run once" is handled by the cold measurement:
+  // "run once" is handled by the cold measurement, or the cpu measurement
+  // for host-only benchmarks:
   if (!(modifier_tags & run_once) && this->get_run_once())
   {
-    constexpr auto run_once_tags = modifier_tags | cold | run_once;
-    this->exec(run_once_tags, std::forward<KernelLauncher>(kernel_launcher));
+    if constexpr (measure_tags & cpu)
+    {
+      constexpr auto run_once_tags = modifier_tags | cpu | run_once;
+      this->exec(run_once_tags, std::forward<KernelLauncher>(kernel_launcher));
+    }
+    else
+    {
+      constexpr auto run_once_tags = modifier_tags | cold | run_once;
+      this->exec(run_once_tags, std::forward<KernelLauncher>(kernel_launcher));
+    }
     return;
   }
 
@@ -123,6 +133,26 @@ void state::exec(ExecTags tags, KernelLauncher &&kernel_launcher)
     }
   }
 
+  if constexpr (tags & cpu)
+  {
+    static_assert(!(tags & (cold | hot)),
+                  "The `cpu` exec_tag cannot be combined with device measurements.");
+    if constexpr (tags & timer)
+    {
+      using measure_t = nvbench::detail::measure_cpu<KL>;
+      measure_t measure{*this, kernel_launcher};
+      measure();
+    }
+    else
+    { // Need to wrap the kernel launcher with a timer wrapper:
+      using wrapper_t = nvbench::detail::kernel_launch_timer_wrapper<KL>;
+      wrapper_t wrapper{kernel_launcher};
+      using measure_t = nvbench::detail::measure_cpu<wrapper_t>;
+      measure_t measure(*this, wrapper);
+      measure();
+    }
+  }
+
   if constexpr (tags & hot)
   {
     static_assert(!(tags & sync), "Hot measurement doesn't support the `sync` exec_tag.");
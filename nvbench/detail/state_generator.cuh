@@ -41,8 +41,11 @@
 #include <nvbench/axis_base.cuh>
 #include <nvbench/state.cuh>
 
+#include <cstdint>
+#include <functional>
 #include <optional>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -54,27 +57,12 @@ struct device_info;
 namespace detail
 {
 
-struct state_generator
-{
-  static std::vector<nvbench::state> create(const benchmark_base &bench);
-
-private:
-  explicit state_generator(const benchmark_base &bench);
-
-  void build_axis_configs();
-  void build_states();
-  void add_states_for_device(const std::optional<nvbench::device_info> &device);
-
-  const benchmark_base &m_benchmark;
-  // bool is a mask value; true if the config is used.
-  std::vector<std::pair<nvbench::named_values, bool>> m_type_axis_configs;
-  std::vector<nvbench::named_values> m_non_type_axis_configs;
-  std::vector<nvbench::state> m_states;
-};
-
 // Detail class; Generates a cartesian product of axis indices.
 // Used by state_generator.
 //
+// Axes added together with `add_zipped_axes` form a single dimension of the
+// product: their indices advance in lockstep.
+//
 // Usage:
 // ```
 // state_iterator sg;
@@ -102,16 +90,130 @@ struct state_iterator
 
   void add_axis(const nvbench::axis_base &axis);
   void add_axis(std::string axis, nvbench::axis_type type, std::size_t size);
+  // All axes must have the same size.
+  void add_zipped_axes(const std::vector<std::reference_wrapper<const nvbench::axis_base>> &axes);
   [[nodiscard]] std::size_t get_number_of_states() const;
   void init();
   [[nodiscard]] const std::vector<axis_index> &get_current_indices() const;
   [[nodiscard]] bool iter_valid() const;
   void next();
+  // Jump to the state with the given linear index (first dimension fastest).
+  void seek(std::size_t linear_index);
+
+  // A contiguous range of m_indices that advances together:
+  struct dimension
+  {
+    std::size_t first;
+    std::size_t count;
+    std::size_t size;
+  };
 
   std::vector<axis_index> m_indices;
+  std::vector<dimension> m_dimensions;
   std::size_t m_current{};
   std::size_t m_total{};
 };
 
+
+/**
+ * Lazily enumerates the states of a benchmark.
+ *
+ * States are constructed one at a time, so the cartesian product of the
+ * benchmark's axes is never materialized. Only the type axis configs (bounded
+ * by the compile-time type list) are precomputed.
+ *
+ * If the benchmark has a `sample_spec` enabled, only a sampled subset of the
+ * states is generated. The sample is drawn once, over the product of the
+ * non-type axes and the active type configs, and is the same for every device.
+ * Configurations rejected by the benchmark's constraints, or assigned to
+ * another shard, are skipped without constructing a state.
+ *
+ * Usage:
+ * ```
+ * state_generator sg{bench};
+ * sg.init(device, type_config_index);
+ * while (auto state = sg.next())
+ * {
+ *   // ...
+ * }
+ * ```
+ */
+struct state_generator
+{
+  /// The states of one device and type config, `[begin, end)` in the vector
+  /// returned by `create`.
+  struct state_span
+  {
+    std::size_t begin;
+    std::size_t end;
+  };
+
+  /// Materialize every state of `bench`, for all of its devices. States are
+  /// ordered by device, then type config.
+  static std::vector<nvbench::state> create(const benchmark_base &bench);
+
+  /// As above. Also sets `spans` to the span of each device and type config,
+  /// at index `device_index * get_number_of_type_configs() + type_config_index`
+  /// where `device_index` is the position in `bench.get_devices()` (0 if
+  /// there are no devices).
+  static std::vector<nvbench::state> create(const benchmark_base &bench,
+                                            std::vector<state_span> &spans);
+
+  /// Count the states generated for each device of `bench`. If the benchmark
+  /// has constraints or shards, this enumerates (but does not construct)
+  /// every state.
+  static std::size_t count_states(const benchmark_base &bench);
+
+  explicit state_generator(const benchmark_base &bench);
+
+  /// Restart enumeration over the non-type axes for the given device and type
+  /// config. No states are generated if the type config is inactive.
+  void init(const std::optional<nvbench::device_info> &device, std::size_t type_config_index);
+
+  /// Construct the next state, or return std::nullopt once all states for the
+  /// current device and type config have been generated.
+  [[nodiscard]] std::optional<nvbench::state> next();
+
+  [[nodiscard]] std::size_t get_number_of_type_configs() const
+  {
+    return m_type_axis_configs.size();
+  }
+
+  /// The number of states generated for each device, ignoring constraints.
+  [[nodiscard]] std::size_t get_number_of_states() const;
+
+private:
+  void build_axis_configs();
+  void build_samples();
+  void build_shard_assignment();
+
+  // The next configuration that satisfies all constraints, if any:
+  [[nodiscard]] std::optional<nvbench::named_values> next_candidate();
+  // As above, but also restricted to the benchmark's shard:
+  [[nodiscard]] std::optional<nvbench::named_values> next_config();
+  [[nodiscard]] bool is_in_shard(const nvbench::named_values &config) const;
+
+  const benchmark_base &m_benchmark;
+  // bool is a mask value; true if the config is used.
+  std::vector<std::pair<nvbench::named_values, bool>> m_type_axis_configs;
+  state_iterator m_non_type_si;
+
+  // Sorted linear indices into (non-type axes x active type configs), with the
+  // non-type axes varying fastest. Only used when m_sampled is true.
+  bool m_sampled{false};
+  std::vector<std::uint64_t> m_samples;
+  // Position of each type config among the active ones:
+  std::vector<std::size_t> m_active_type_config_ranks;
+  std::size_t m_next_sample{};
+  std::size_t m_end_sample{};
+
+  // Hashes of the configs in this shard, if shards are balanced by cost:
+  std::optional<std::unordered_set<std::uint64_t>> m_shard_configs;
+
+  std::optional<nvbench::device_info> m_device;
+  std::size_t m_type_config_index{};
+  bool m_type_config_active{false};
+};
+
 } // namespace detail
 } // namespace nvbench
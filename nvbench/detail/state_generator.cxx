@@ -40,14 +40,18 @@
 #include <nvbench/benchmark_base.cuh>
 #include <nvbench/device_info.cuh>
 #include <nvbench/named_values.cuh>
+#include <nvbench/sharding.cuh>
 #include <nvbench/type_axis.cuh>
 
+#include <nvbench/detail/config_sampling.cuh>
+#include <nvbench/detail/throw.cuh>
 #include <nvbench/detail/transform_reduce.cuh>
 
 #include <algorithm>
 #include <cassert>
 #include <functional>
 #include <numeric>
+#include <stdexcept>
 
 namespace nvbench::detail
 {
@@ -61,18 +65,43 @@ void state_iterator::add_axis(const nvbench::axis_base &axis)
 
 void state_iterator::add_axis(std::string axis, nvbench::axis_type type, std::size_t size)
 {
+  m_dimensions.push_back({m_indices.size(), 1, size});
   m_indices.push_back({std::move(axis), type, std::size_t{0}, size});
 }
 
+void state_iterator::add_zipped_axes(
+  const std::vector<std::reference_wrapper<const nvbench::axis_base>> &axes)
+{
+  if (axes.empty())
+  {
+    return;
+  }
+
+  const std::size_t size = axes.front().get().get_size();
+  m_dimensions.push_back({m_indices.size(), axes.size(), size});
+  for (const nvbench::axis_base &axis : axes)
+  {
+    if (axis.get_size() != size)
+    {
+      NVBENCH_THROW(std::runtime_error,
+                    "Zipped axes must have the same number of values "
+                    "('{}' has {}, '{}' has {}).",
+                    axis.get_name(),
+                    axis.get_size(),
+                    axes.front().get().get_name(),
+                    size);
+    }
+    m_indices.push_back({axis.get_name(), axis.get_type(), std::size_t{0}, size});
+  }
+}
+
 [[nodiscard]] std::size_t state_iterator::get_number_of_states() const
 {
-  return nvbench::detail::transform_reduce(m_indices.cbegin(),
-                                           m_indices.cend(),
+  return nvbench::detail::transform_reduce(m_dimensions.cbegin(),
+                                           m_dimensions.cend(),
                                            std::size_t{1},
                                            std::multiplies<>{},
-                                           [](const axis_index &size_info) {
-                                             return size_info.size;
-                                           });
+                                           [](const dimension &dim) { return dim.size; });
 }
 
 void state_iterator::init()
@@ -95,35 +124,61 @@ state_iterator::get_current_indices() const
 
 void state_iterator::next()
 {
-  for (axis_index &axis_info : m_indices)
+  for (const dimension &dim : m_dimensions)
   {
-    axis_info.index += 1;
-    if (axis_info.index >= axis_info.size)
+    const auto first = m_indices.begin() + static_cast<std::ptrdiff_t>(dim.first);
+    const auto last  = first + static_cast<std::ptrdiff_t>(dim.count);
+
+    std::size_t index = first->index + 1;
+    if (index >= dim.size)
+    {
+      index = 0;
+    }
+    std::for_each(first, last, [index](axis_index &axis_info) { axis_info.index = index; });
+
+    if (index == 0)
     {
-      axis_info.index = 0;
-      continue; // carry the addition to the next entry in m_indices
+      continue; // carry the addition to the next dimension
     }
     break; // done
   }
   m_current += 1;
 }
 
+void state_iterator::seek(std::size_t linear_index)
+{
+  m_current = linear_index;
+  for (const dimension &dim : m_dimensions)
+  {
+    const std::size_t index = linear_index % dim.size;
+    linear_index /= dim.size;
+
+    const auto first = m_indices.begin() + static_cast<std::ptrdiff_t>(dim.first);
+    std::for_each(first, first + static_cast<std::ptrdiff_t>(dim.count), [index](axis_index &axis_info) {
+      axis_info.index = index;
+    });
+  }
+}
+
 // state_generator =============================================================
 
 state_generator::state_generator(const benchmark_base &bench)
     : m_benchmark(bench)
-{}
+{
+  this->build_axis_configs();
+  this->build_samples();
+  this->build_shard_assignment();
+}
 
 void state_generator::build_axis_configs()
 {
   const axes_metadata &axes                               = m_benchmark.get_axes();
   const std::vector<std::unique_ptr<axis_base>> &axes_vec = axes.get_axes();
 
-  // Construct two state_generators:
+  // Construct two state_iterators:
   // - Only type_axis objects.
   // - Only non-type axes.
   state_iterator type_si;
-  state_iterator non_type_si;
 
   // state_iterator initialization:
   {
@@ -131,17 +186,41 @@ void state_generator::build_axis_configs()
     std::vector<std::reference_wrapper<const type_axis>> type_axes;
     type_axes.reserve(axes_vec.size());
 
-    // Filter all axes by into type and non-type:
-    std::for_each(axes_vec.cbegin(), axes_vec.cend(), [&non_type_si, &type_axes](const auto &axis) {
-      if (axis->get_type() == nvbench::axis_type::type)
-      {
-        type_axes.push_back(std::cref(static_cast<const type_axis &>(*axis)));
-      }
-      else
-      {
-        non_type_si.add_axis(*axis);
-      }
-    });
+    // Filter all axes by into type and non-type. Zipped axes are added as a
+    // single dimension where the first of them is declared:
+    std::for_each(axes_vec.cbegin(),
+                  axes_vec.cend(),
+                  [&non_type_si = m_non_type_si, &type_axes, &axes](const auto &axis) {
+                    if (axis->get_type() == nvbench::axis_type::type)
+                    {
+                      type_axes.push_back(std::cref(static_cast<const type_axis &>(*axis)));
+                      return;
+                    }
+
+                    const auto *zip_group = axes.get_zip_group(axis->get_name());
+                    if (zip_group == nullptr)
+                    {
+                      non_type_si.add_axis(*axis);
+                      return;
+                    }
+
+                    const bool group_added = std::any_of(
+                      non_type_si.m_indices.cbegin(),
+                      non_type_si.m_indices.cend(),
+                      [zip_group](const auto &index) {
+                        return index.axis == zip_group->front();
+                      });
+                    if (!group_added)
+                    {
+                      std::vector<std::reference_wrapper<const axis_base>> zipped;
+                      zipped.reserve(zip_group->size());
+                      for (const auto &name : *zip_group)
+                      {
+                        zipped.push_back(std::cref(axes.get_axis(name)));
+                      }
+                      non_type_si.add_zipped_axes(zipped);
+                    }
+                  });
 
     // Reverse sort type axes by index. This way the state_generator's cartesian
     // product of the type axes values will be enumerated in the same order as
@@ -186,93 +265,312 @@ void state_generator::build_axis_configs()
     } // type_si
   }   // type_axis_config generation
 
-  // non_type_axis_config generation
+  // Non-type axis configs are generated on demand by next().
+}
+
+void state_generator::build_samples()
+{
+  m_active_type_config_ranks.clear();
+  m_active_type_config_ranks.reserve(m_type_axis_configs.size());
+  std::size_t num_active = 0;
+  for (const auto &[config, active] : m_type_axis_configs)
   {
-    m_non_type_axis_configs.clear();
-    m_non_type_axis_configs.reserve(type_si.get_number_of_states());
+    m_active_type_config_ranks.push_back(active ? num_active++ : num_active);
+  }
 
-    for (non_type_si.init(); non_type_si.iter_valid(); non_type_si.next())
-    {
-      auto &config = m_non_type_axis_configs.emplace_back();
+  const auto &spec = m_benchmark.get_sample_spec();
+  m_sampled        = spec.is_enabled();
+  m_samples.clear();
+  if (!m_sampled)
+  {
+    return;
+  }
 
-      // Add non-type parameters to state:
-      for (const auto &axis_info : non_type_si.get_current_indices())
+  // The active type configs form the slowest-varying dimension:
+  std::vector<std::uint64_t> dim_sizes;
+  dim_sizes.reserve(m_non_type_si.m_dimensions.size() + 1);
+  for (const auto &dim : m_non_type_si.m_dimensions)
+  {
+    dim_sizes.push_back(dim.size);
+  }
+  dim_sizes.push_back(num_active);
+
+  m_samples = nvbench::detail::sample_configs(spec.method,
+                                              static_cast<std::uint64_t>(spec.count),
+                                              dim_sizes,
+                                              static_cast<std::uint64_t>(
+                                                m_benchmark.get_sample_seed()));
+}
+
+void state_generator::build_shard_assignment()
+{
+  const auto &shard = m_benchmark.get_shard();
+  const auto &costs = m_benchmark.get_shard_costs();
+  m_shard_configs.reset();
+  if (!shard.is_enabled() || !costs)
+  {
+    return;
+  }
+
+  // Balance shards with the greedy longest-processing-time heuristic. Every
+  // shard enumerates the same configs and breaks ties the same way, so they
+  // agree on the assignment. Configs without a prior cost are assumed to
+  // cost the average.
+  std::vector<std::pair<nvbench::float64_t, std::uint64_t>> configs;
+  nvbench::float64_t known_cost{};
+  std::size_t num_known{};
+  for (std::size_t type_config_index = 0; type_config_index < m_type_axis_configs.size();
+       ++type_config_index)
+  {
+    this->init(std::nullopt, type_config_index);
+    while (auto config = this->next_candidate())
+    {
+      const auto hash = nvbench::hash_config(m_benchmark.get_name(), *config);
+      const auto iter = costs->find(hash);
+      if (iter != costs->cend())
       {
-        switch (axis_info.type)
-        {
-          default:
-          case axis_type::type:
-            assert("unreachable." && false);
-            break;
-
-          case axis_type::int64:
-            config.set_int64(axis_info.axis,
-                             axes.get_int64_axis(axis_info.axis).get_value(axis_info.index));
-            break;
-
-          case axis_type::float64:
-            config.set_float64(axis_info.axis,
-                               axes.get_float64_axis(axis_info.axis).get_value(axis_info.index));
-            break;
-
-          case axis_type::string:
-            config.set_string(axis_info.axis,
-                              axes.get_string_axis(axis_info.axis).get_value(axis_info.index));
-            break;
-        } // switch (type)
-      }   // for (axis_info : current_indices)
-    }     // for non_type_sg configs
-  }       // non_type_axis_config generation
+        known_cost += iter->second;
+        ++num_known;
+      }
+      configs.emplace_back(iter != costs->cend() ? iter->second : -1., hash);
+    }
+  }
+
+  const auto default_cost = num_known > 0 ? known_cost / static_cast<nvbench::float64_t>(num_known)
+                                          : 1.;
+  for (auto &config : configs)
+  {
+    if (config.first < 0.)
+    {
+      config.first = default_cost;
+    }
+  }
+  std::sort(configs.begin(), configs.end(), [](const auto &lhs, const auto &rhs) {
+    return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+  });
+
+  // (cost, number of configs) per shard. The count breaks ties, e.g. when
+  // the prior run skipped every config:
+  std::vector<std::pair<nvbench::float64_t, std::size_t>> loads(
+    static_cast<std::size_t>(shard.count));
+  m_shard_configs.emplace();
+  for (const auto &[cost, hash] : configs)
+  {
+    const auto lightest = static_cast<nvbench::int64_t>(
+      std::min_element(loads.cbegin(), loads.cend()) - loads.cbegin());
+    loads[static_cast<std::size_t>(lightest)].first += cost;
+    loads[static_cast<std::size_t>(lightest)].second += 1;
+    if (lightest == shard.index)
+    {
+      m_shard_configs->insert(hash);
+    }
+  }
 }
 
-void state_generator::build_states()
+bool state_generator::is_in_shard(const nvbench::named_values &config) const
 {
-  m_states.clear();
+  const auto &shard = m_benchmark.get_shard();
+  if (!shard.is_enabled())
+  {
+    return true;
+  }
 
-  const auto &devices = m_benchmark.get_devices();
-  if (devices.empty())
+  const auto hash = nvbench::hash_config(m_benchmark.get_name(), config);
+  if (m_shard_configs)
   {
-    this->add_states_for_device(std::nullopt);
+    return m_shard_configs->count(hash) != 0;
   }
-  else
+  return static_cast<nvbench::int64_t>(hash % static_cast<std::uint64_t>(shard.count)) ==
+         shard.index;
+}
+
+std::size_t state_generator::get_number_of_states() const
+{
+  if (m_sampled)
   {
-    for (const auto &device : devices)
+    return m_samples.size();
+  }
+
+  const auto num_active = static_cast<std::size_t>(
+    std::count_if(m_type_axis_configs.cbegin(),
+                  m_type_axis_configs.cend(),
+                  [](const auto &config) { return config.second; }));
+  return num_active * m_non_type_si.get_number_of_states();
+}
+
+void state_generator::init(const std::optional<device_info> &device,
+                           std::size_t type_config_index)
+{
+  m_device             = device;
+  m_type_config_index  = type_config_index;
+  m_type_config_active = type_config_index < m_type_axis_configs.size() &&
+                         m_type_axis_configs[type_config_index].second;
+  m_non_type_si.init();
+
+  if (m_sampled && m_type_config_active)
+  {
+    // Select the samples that fall within this type config:
+    const std::uint64_t num_non_type = m_non_type_si.get_number_of_states();
+    const std::uint64_t first = m_active_type_config_ranks[type_config_index] * num_non_type;
+    const auto begin = std::lower_bound(m_samples.cbegin(), m_samples.cend(), first);
+    const auto end   = std::lower_bound(begin, m_samples.cend(), first + num_non_type);
+    m_next_sample    = static_cast<std::size_t>(begin - m_samples.cbegin());
+    m_end_sample     = static_cast<std::size_t>(end - m_samples.cbegin());
+  }
+}
+
+std::optional<nvbench::state> state_generator::next()
+{
+  auto config = this->next_config();
+  if (!config)
+  {
+    return std::nullopt;
+  }
+  return nvbench::state{m_benchmark, std::move(*config), m_device, m_type_config_index};
+}
+
+std::optional<nvbench::named_values> state_generator::next_config()
+{
+  while (auto config = this->next_candidate())
+  {
+    if (this->is_in_shard(*config))
     {
-      this->add_states_for_device(device);
+      return config;
     }
   }
+  return std::nullopt;
 }
 
-void state_generator::add_states_for_device(const std::optional<device_info> &device)
+std::optional<nvbench::named_values> state_generator::next_candidate()
 {
-  const auto num_type_configs = m_type_axis_configs.size();
-  for (std::size_t type_config_index = 0; type_config_index < num_type_configs; ++type_config_index)
+  if (!m_type_config_active)
   {
-    const auto &[type_config, axis_mask] = m_type_axis_configs[type_config_index];
+    return std::nullopt;
+  }
 
-    if (!axis_mask)
-    { // Don't generate inner vector if the type config is masked out.
-      continue;
+  const axes_metadata &axes = m_benchmark.get_axes();
+  const auto &constraints   = m_benchmark.get_constraints();
+  while (true)
+  {
+    if (m_sampled)
+    {
+      if (m_next_sample == m_end_sample)
+      {
+        return std::nullopt;
+      }
+      const std::uint64_t num_non_type = m_non_type_si.get_number_of_states();
+      m_non_type_si.seek(static_cast<std::size_t>(m_samples[m_next_sample++] % num_non_type));
+    }
+    else if (!m_non_type_si.iter_valid())
+    {
+      return std::nullopt;
     }
 
-    for (const auto &non_type_config : m_non_type_axis_configs)
+    // Concatenate the type + non_type configurations:
+    nvbench::named_values config = m_type_axis_configs[m_type_config_index].first;
+
+    // Add non-type parameters to state:
+    for (const auto &axis_info : m_non_type_si.get_current_indices())
+    {
+      switch (axis_info.type)
+      {
+        default:
+        case axis_type::type:
+          assert("unreachable." && false);
+          break;
+
+        case axis_type::int64:
+          config.set_int64(axis_info.axis,
+                           axes.get_int64_axis(axis_info.axis).get_value(axis_info.index));
+          break;
+
+        case axis_type::float64:
+          config.set_float64(axis_info.axis,
+                             axes.get_float64_axis(axis_info.axis).get_value(axis_info.index));
+          break;
+
+        case axis_type::string:
+          config.set_string(axis_info.axis,
+                            axes.get_string_axis(axis_info.axis).get_value(axis_info.index));
+          break;
+      } // switch (type)
+    }   // for (axis_info : current_indices)
+    m_non_type_si.next();
+
+    // Pruned configs never become states:
+    if (std::all_of(constraints.cbegin(), constraints.cend(), [&config](const auto &constraint) {
+          return constraint(config);
+        }))
     {
-      // Concatenate the type + non_type configurations:
-      nvbench::named_values config = type_config;
-      config.append(non_type_config);
+      return config;
+    }
+  } // while (true)
+}
 
-      // Create benchmark:
-      m_states.push_back(nvbench::state{m_benchmark, std::move(config), device, type_config_index});
+std::size_t state_generator::count_states(const benchmark_base &bench)
+{
+  state_generator sg{bench};
+  if (bench.get_constraints().empty() && !bench.get_shard().is_enabled())
+  {
+    return sg.get_number_of_states();
+  }
+
+  std::size_t count = 0;
+  for (std::size_t type_config_index = 0; type_config_index < sg.get_number_of_type_configs();
+       ++type_config_index)
+  {
+    sg.init(std::nullopt, type_config_index);
+    while (sg.next_config())
+    {
+      ++count;
     }
   }
+  return count;
 }
 
 std::vector<nvbench::state> state_generator::create(const benchmark_base &bench)
+{
+  std::vector<state_span> spans;
+  return state_generator::create(bench, spans);
+}
+
+std::vector<nvbench::state> state_generator::create(const benchmark_base &bench,
+                                                    std::vector<state_span> &spans)
 {
   state_generator sg{bench};
-  sg.build_axis_configs();
-  sg.build_states();
-  return std::move(sg.m_states);
+  std::vector<nvbench::state> states;
+  spans.clear();
+
+  const auto add_states_for_device = [&sg, &states, &spans](
+                                       const std::optional<device_info> &device) {
+    const auto num_type_configs = sg.get_number_of_type_configs();
+    for (std::size_t type_config_index = 0; type_config_index < num_type_configs;
+         ++type_config_index)
+    {
+      const std::size_t begin = states.size();
+      sg.init(device, type_config_index);
+      while (auto state = sg.next())
+      {
+        states.push_back(std::move(*state));
+      }
+      spans.push_back({begin, states.size()});
+    }
+  };
+
+  const auto &devices = bench.get_devices();
+  if (devices.empty())
+  {
+    add_states_for_device(std::nullopt);
+  }
+  else
+  {
+    for (const auto &device : devices)
+    {
+      add_states_for_device(device);
+    }
+  }
+
+  return states;
 }
 
 } // namespace nvbench::detail
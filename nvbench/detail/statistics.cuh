@@ -41,11 +41,17 @@
 
 #include <nvbench/detail/transform_reduce.cuh>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace nvbench::detail::statistics
 {
@@ -79,4 +85,443 @@ ValueType standard_deviation(Iter first, Iter last, ValueType mean)
   return std::sqrt(variance);
 }
 
+/**
+ * Streaming mean and variance accumulator (Welford's algorithm).
+ *
+ * Produces the same results as `standard_deviation` over all values passed to
+ * `add`, but without retaining them and in constant time per value. This keeps
+ * per-sample convergence checks cheap regardless of the number of samples.
+ */
+template <typename ValueType = nvbench::float64_t>
+struct running_statistics
+{
+  static_assert(std::is_floating_point_v<ValueType>);
+
+  void clear()
+  {
+    m_size = 0;
+    m_mean = ValueType{};
+    m_m2   = ValueType{};
+  }
+
+  void add(ValueType val)
+  {
+    ++m_size;
+    const ValueType delta = val - m_mean;
+    m_mean += delta / static_cast<ValueType>(m_size);
+    m_m2 += delta * (val - m_mean);
+  }
+
+  [[nodiscard]] std::size_t size() const { return m_size; }
+
+  [[nodiscard]] ValueType mean() const { return m_mean; }
+
+  /**
+   * The unbiased sample variance. If fewer than 2 values have been added,
+   * infinity is returned.
+   */
+  [[nodiscard]] ValueType variance() const
+  {
+    if (m_size < 2)
+    {
+      return std::numeric_limits<ValueType>::infinity();
+    }
+    return m_m2 / static_cast<ValueType>(m_size - 1);
+  }
+
+  /**
+   * The unbiased sample standard deviation. Matches `standard_deviation` and
+   * returns infinity if fewer than 5 values have been added.
+   */
+  [[nodiscard]] ValueType standard_deviation() const
+  {
+    if (m_size < 5) // don't bother with low sample sizes.
+    {
+      return std::numeric_limits<ValueType>::infinity();
+    }
+    return std::sqrt(this->variance());
+  }
+
+private:
+  std::size_t m_size{};
+  ValueType m_mean{};
+  ValueType m_m2{}; // Sum of squared differences from the current mean
+};
+
+/**
+ * Returns the `p`-quantile (0 <= p <= 1) of [first, last), linearly
+ * interpolating between the two closest ranks.
+ *
+ * Uses `std::nth_element` rather than sorting, so this is O(N) and reorders
+ * the input range. If the range is empty, NaN is returned.
+ */
+template <typename Iter, typename ValueType = typename std::iterator_traits<Iter>::value_type>
+ValueType percentile(Iter first, Iter last, nvbench::float64_t p)
+{
+  static_assert(std::is_floating_point_v<ValueType>);
+
+  const auto num = last - first;
+  if (num == 0)
+  {
+    return std::numeric_limits<ValueType>::quiet_NaN();
+  }
+
+  const auto rank = std::clamp(p, 0., 1.) * static_cast<nvbench::float64_t>(num - 1);
+  const auto lo   = static_cast<decltype(num)>(rank);
+  const auto frac = static_cast<ValueType>(rank - static_cast<nvbench::float64_t>(lo));
+
+  std::nth_element(first, first + lo, last);
+  const ValueType lo_val = *(first + lo);
+  if (frac == ValueType{} || lo + 1 == num)
+  {
+    return lo_val;
+  }
+
+  // nth_element leaves everything after `lo` no smaller than it, so the next
+  // order statistic is the minimum of that partition:
+  const ValueType hi_val = *std::min_element(first + lo + 1, last);
+  return lo_val + frac * (hi_val - lo_val);
+}
+
+/**
+ * Order statistics reported for a set of timings.
+ */
+template <typename ValueType = nvbench::float64_t>
+struct percentile_summary
+{
+  ValueType min;
+  ValueType median;
+  ValueType p90;
+  ValueType p99;
+  ValueType max;
+};
+
+/**
+ * Computes exact order statistics of `values` by selection. The vector is
+ * taken by value since the selection reorders it.
+ */
+template <typename ValueType>
+percentile_summary<ValueType> compute_percentile_summary(std::vector<ValueType> values)
+{
+  if (values.empty())
+  {
+    const auto nan = std::numeric_limits<ValueType>::quiet_NaN();
+    return {nan, nan, nan, nan, nan};
+  }
+
+  const auto [min_iter, max_iter] = std::minmax_element(values.cbegin(), values.cend());
+  percentile_summary<ValueType> result{};
+  result.min    = *min_iter;
+  result.max    = *max_iter;
+  result.median = percentile(values.begin(), values.end(), 0.5);
+  result.p90    = percentile(values.begin(), values.end(), 0.9);
+  result.p99    = percentile(values.begin(), values.end(), 0.99);
+  return result;
+}
+
+/**
+ * Streaming estimate of a single quantile using the P-square algorithm
+ * (Jain & Chlamtac, 1985).
+ *
+ * Five markers are adjusted as values arrive, so memory and per-value cost are
+ * constant. Results are exact until five values have been added.
+ */
+template <typename ValueType = nvbench::float64_t>
+struct p2_quantile
+{
+  static_assert(std::is_floating_point_v<ValueType>);
+
+  explicit p2_quantile(nvbench::float64_t p)
+      : m_p{std::clamp(p, 0., 1.)}
+  {
+    this->clear();
+  }
+
+  [[nodiscard]] nvbench::float64_t get_probability() const { return m_p; }
+
+  void clear()
+  {
+    const auto p = static_cast<ValueType>(m_p);
+    m_size       = 0;
+    m_positions  = {1, 2, 3, 4, 5};
+    m_desired    = {1, 1 + 2 * p, 1 + 4 * p, 3 + 2 * p, 5};
+    m_increments = {0, p / 2, p, (1 + p) / 2, 1};
+  }
+
+  void add(ValueType val)
+  {
+    if (m_size < 5)
+    {
+      m_heights[m_size++] = val;
+      if (m_size == 5)
+      {
+        std::sort(m_heights.begin(), m_heights.end());
+      }
+      return;
+    }
+    ++m_size;
+
+    // Find the cell containing `val`, extending the extreme markers if needed:
+    std::size_t cell{};
+    if (val < m_heights[0])
+    {
+      m_heights[0] = val;
+      cell         = 0;
+    }
+    else if (val >= m_heights[4])
+    {
+      m_heights[4] = val;
+      cell         = 3;
+    }
+    else
+    {
+      cell = 0;
+      while (val >= m_heights[cell + 1])
+      {
+        ++cell;
+      }
+    }
+
+    for (std::size_t i = cell + 1; i < 5; ++i)
+    {
+      m_positions[i] += 1;
+    }
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+      m_desired[i] += m_increments[i];
+    }
+
+    // Move the middle markers toward their desired positions:
+    for (std::size_t i = 1; i < 4; ++i)
+    {
+      const ValueType offset = m_desired[i] - m_positions[i];
+      if ((offset >= 1 && m_positions[i + 1] - m_positions[i] > 1) ||
+          (offset <= -1 && m_positions[i - 1] - m_positions[i] < -1))
+      {
+        const ValueType dir = offset > 0 ? ValueType{1} : ValueType{-1};
+        const ValueType candidate = this->parabolic(i, dir);
+        m_heights[i] = (m_heights[i - 1] < candidate && candidate < m_heights[i + 1])
+                         ? candidate
+                         : this->linear(i, dir);
+        m_positions[i] += dir;
+      }
+    }
+  }
+
+  [[nodiscard]] std::size_t size() const { return m_size; }
+
+  /**
+   * The current quantile estimate. If no values have been added, NaN is
+   * returned.
+   */
+  [[nodiscard]] ValueType quantile() const
+  {
+    if (m_size >= 5)
+    {
+      return m_heights[2];
+    }
+    auto heights = m_heights;
+    return percentile(heights.begin(), heights.begin() + m_size, m_p);
+  }
+
+private:
+  [[nodiscard]] ValueType parabolic(std::size_t i, ValueType dir) const
+  {
+    const auto &q = m_heights;
+    const auto &n = m_positions;
+    return q[i] + dir / (n[i + 1] - n[i - 1]) *
+                    ((n[i] - n[i - 1] + dir) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                     (n[i + 1] - n[i] - dir) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+  }
+
+  [[nodiscard]] ValueType linear(std::size_t i, ValueType dir) const
+  {
+    const auto j = dir > 0 ? i + 1 : i - 1;
+    return m_heights[i] + dir * (m_heights[j] - m_heights[i]) / (m_positions[j] - m_positions[i]);
+  }
+
+  nvbench::float64_t m_p;
+  std::size_t m_size{};
+  std::array<ValueType, 5> m_heights{};    // Marker heights (quantile estimates)
+  std::array<ValueType, 5> m_positions{};  // Actual marker positions (1-based ranks)
+  std::array<ValueType, 5> m_desired{};    // Desired marker positions
+  std::array<ValueType, 5> m_increments{}; // Change in desired positions per value
+};
+
+/**
+ * Constant-memory alternative to `compute_percentile_summary` for runs that
+ * are too long to retain every sample. The extremes are exact; the median,
+ * p90 and p99 are P-square estimates.
+ */
+template <typename ValueType = nvbench::float64_t>
+struct streaming_percentiles
+{
+  void clear()
+  {
+    m_min = std::numeric_limits<ValueType>::infinity();
+    m_max = -std::numeric_limits<ValueType>::infinity();
+    m_median.clear();
+    m_p90.clear();
+    m_p99.clear();
+  }
+
+  void add(ValueType val)
+  {
+    m_min = std::min(m_min, val);
+    m_max = std::max(m_max, val);
+    m_median.add(val);
+    m_p90.add(val);
+    m_p99.add(val);
+  }
+
+  [[nodiscard]] std::size_t size() const { return m_median.size(); }
+
+  [[nodiscard]] percentile_summary<ValueType> get() const
+  {
+    if (this->size() == 0)
+    {
+      const auto nan = std::numeric_limits<ValueType>::quiet_NaN();
+      return {nan, nan, nan, nan, nan};
+    }
+    return {m_min, m_median.quantile(), m_p90.quantile(), m_p99.quantile(), m_max};
+  }
+
+private:
+  ValueType m_min{std::numeric_limits<ValueType>::infinity()};
+  ValueType m_max{-std::numeric_limits<ValueType>::infinity()};
+  p2_quantile<ValueType> m_median{0.5};
+  p2_quantile<ValueType> m_p90{0.9};
+  p2_quantile<ValueType> m_p99{0.99};
+};
+
+/**
+ * A small, fast PRNG (xoshiro256**) for resampling. Not suitable for
+ * cryptographic use.
+ */
+struct xoshiro256ss
+{
+  explicit xoshiro256ss(std::uint64_t seed)
+  {
+    // Expand the seed with splitmix64, as recommended by the authors:
+    for (auto &word : m_state)
+    {
+      seed += 0x9e3779b97f4a7c15ull;
+      std::uint64_t z = seed;
+      z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+      z               = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+      word            = z ^ (z >> 31);
+    }
+  }
+
+  std::uint64_t operator()()
+  {
+    const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+    const std::uint64_t t      = m_state[1] << 17;
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3] = rotl(m_state[3], 45);
+    return result;
+  }
+
+  /// A uniformly distributed integer in [0, bound), for bound < 2^32.
+  std::uint64_t bounded(std::uint64_t bound)
+  {
+    // Lemire's multiply-shift avoids a division per draw:
+    return (((*this)() >> 32) * bound) >> 32;
+  }
+
+private:
+  static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  std::uint64_t m_state[4];
+};
+
+/**
+ * Lower and upper bounds of a confidence interval.
+ */
+template <typename ValueType = nvbench::float64_t>
+struct confidence_interval
+{
+  ValueType low;
+  ValueType high;
+};
+
+/**
+ * Percentile bootstrap confidence interval for the mean of [first, last).
+ *
+ * `num_resamples` means of resamples (drawn with replacement) are computed
+ * across up to `max_threads` host threads (0 uses the hardware concurrency).
+ * Each resample draws from its own PRNG stream derived from `seed`, so the
+ * result does not depend on the number of threads.
+ *
+ * If the range holds fewer than 2 values, {NaN, NaN} is returned.
+ */
+template <typename Iter, typename ValueType = typename std::iterator_traits<Iter>::value_type>
+confidence_interval<ValueType> bootstrap_mean_ci(Iter first,
+                                                 Iter last,
+                                                 nvbench::float64_t confidence = 0.95,
+                                                 std::size_t num_resamples   = 1000,
+                                                 std::uint64_t seed          = 0,
+                                                 unsigned int max_threads    = 0)
+{
+  static_assert(std::is_floating_point_v<ValueType>);
+
+  const auto num = static_cast<std::size_t>(last - first);
+  if (num < 2 || num_resamples == 0)
+  {
+    const auto nan = std::numeric_limits<ValueType>::quiet_NaN();
+    return {nan, nan};
+  }
+
+  std::vector<ValueType> means(num_resamples);
+  const auto resample = [first, num, seed, &means](std::size_t begin, std::size_t stride) {
+    const bool use_lemire = num <= std::numeric_limits<std::uint32_t>::max();
+    for (std::size_t r = begin; r < means.size(); r += stride)
+    {
+      xoshiro256ss rng{seed ^ (0x5851f42d4c957f2dull * (r + 1))};
+      ValueType sum{};
+      for (std::size_t i = 0; i < num; ++i)
+      {
+        const auto idx = use_lemire ? rng.bounded(num) : rng() % num;
+        sum += first[static_cast<typename std::iterator_traits<Iter>::difference_type>(idx)];
+      }
+      means[r] = sum / static_cast<ValueType>(num);
+    }
+  };
+
+  // Threads only pay off once there is enough work to amortize their startup:
+  constexpr std::size_t min_draws_per_thread = std::size_t{1} << 18;
+  const std::size_t hw_threads =
+    max_threads > 0 ? max_threads : std::max(1u, std::thread::hardware_concurrency());
+  const std::size_t num_threads =
+    std::clamp<std::size_t>((num * num_resamples) / min_draws_per_thread, 1, hw_threads);
+
+  if (num_threads == 1)
+  {
+    resample(0, 1);
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    for (std::size_t t = 1; t < num_threads; ++t)
+    {
+      threads.emplace_back(resample, t, num_threads);
+    }
+    resample(0, num_threads);
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  const auto alpha = (1. - std::clamp(confidence, 0., 1.)) / 2.;
+  const auto low   = percentile(means.begin(), means.end(), alpha);
+  const auto high  = percentile(means.begin(), means.end(), 1. - alpha);
+  return {low, high};
+}
+
 } // namespace nvbench::detail::statistics
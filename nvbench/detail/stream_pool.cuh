@@ -0,0 +1,118 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <hip/hip_runtime_api.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace nvbench::detail
+{
+
+struct stream_pool;
+
+/**
+ * A stream borrowed from `stream_pool`. The stream is returned to the pool
+ * when the lease is destroyed or reset.
+ */
+struct stream_lease
+{
+  stream_lease() = default;
+  ~stream_lease() { this->reset(); }
+
+  // move-only
+  stream_lease(const stream_lease &)            = delete;
+  stream_lease &operator=(const stream_lease &) = delete;
+  stream_lease(stream_lease &&other) noexcept
+      : m_device_id{other.m_device_id}
+      , m_stream{std::exchange(other.m_stream, nullptr)}
+  {}
+  stream_lease &operator=(stream_lease &&other) noexcept
+  {
+    if (this != &other)
+    {
+      this->reset();
+      m_device_id = other.m_device_id;
+      m_stream    = std::exchange(other.m_stream, nullptr);
+    }
+    return *this;
+  }
+
+  [[nodiscard]] hipStream_t get_stream() const { return m_stream; }
+  [[nodiscard]] int get_device_id() const { return m_device_id; }
+  [[nodiscard]] explicit operator bool() const { return m_stream != nullptr; }
+
+  /// Return the stream to the pool early.
+  void reset() noexcept;
+
+private:
+  friend struct stream_pool;
+
+  stream_lease(int device_id, hipStream_t stream)
+      : m_device_id{device_id}
+      , m_stream{stream}
+  {}
+
+  int m_device_id{-1};
+  hipStream_t m_stream{nullptr};
+};
+
+/**
+ * Process-wide pool of `hipStream_t`s, one free list per device.
+ *
+ * States acquire a stream the first time they need one and return it once
+ * they have run, so the number of streams created is bounded by the number
+ * of states that are alive at once rather than by the size of the axis space.
+ */
+struct stream_pool
+{
+  [[nodiscard]] static stream_pool &get();
+
+  /// Borrow a stream on device `device_id`, creating one if none are free.
+  [[nodiscard]] stream_lease acquire(int device_id);
+
+  /// Total number of streams created by the pool in this process.
+  [[nodiscard]] nvbench::int64_t get_number_of_streams_created() const;
+
+private:
+  friend struct stream_lease;
+
+  stream_pool() = default;
+
+  void release(int device_id, hipStream_t stream) noexcept;
+
+  struct device_streams
+  {
+    std::vector<hipStream_t> free_streams;
+    // Capacity reserved in `free_streams`, one slot per stream created on the
+    // device, so `release` never allocates:
+    std::size_t num_slots{};
+  };
+
+  mutable std::mutex m_mutex;
+  // Indexed by device id:
+  std::vector<device_streams> m_devices;
+  nvbench::int64_t m_streams_created{};
+};
+
+} // namespace nvbench::detail
@@ -0,0 +1,66 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/printer_base.cuh>
+
+#include <mutex>
+
+namespace nvbench::detail
+{
+
+/*!
+ * An nvbench::printer_base that forwards calls to another printer while
+ * holding a lock, so the printer can be shared by threads that run states
+ * concurrently. Log lines are written whole, and each thread's
+ * `log_run_state` / `add_completed_state` calls reach the printer in order.
+ *
+ * The lock is recursive, since printers may log through the benchmark's
+ * printer (this one) while handling a call.
+ */
+struct synchronized_printer : nvbench::printer_base
+{
+  explicit synchronized_printer(nvbench::printer_base &printer);
+
+  void set_completed_state_count(std::size_t states) override;
+  void add_completed_state() override;
+  [[nodiscard]] std::size_t get_completed_state_count() const override;
+
+  void set_total_state_count(std::size_t states) override;
+  [[nodiscard]] std::size_t get_total_state_count() const override;
+
+protected:
+  void do_log_argv(const std::vector<std::string> &argv) override;
+  void do_print_device_info() override;
+  void do_print_log_preamble() override;
+  void do_print_log_epilogue() override;
+  void do_log(nvbench::log_level, const std::string &) override;
+  void do_log_run_state(const nvbench::state &) override;
+  void do_process_bulk_data_float64(nvbench::state &,
+                                    const std::string &,
+                                    const std::string &,
+                                    const std::vector<nvbench::float64_t> &) override;
+  void do_print_benchmark_list(const benchmark_vector &benches) override;
+  void do_print_benchmark_results(const benchmark_vector &benches) override;
+
+  nvbench::printer_base &m_printer;
+  mutable std::recursive_mutex m_mutex;
+};
+
+} // namespace nvbench::detail
@@ -0,0 +1,118 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/synchronized_printer.cuh>
+
+#include <iostream>
+
+namespace nvbench::detail
+{
+
+synchronized_printer::synchronized_printer(nvbench::printer_base &printer)
+    : printer_base(std::cerr) // Nothing should write to this.
+    , m_printer{printer}
+{}
+
+void synchronized_printer::set_completed_state_count(std::size_t states)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.set_completed_state_count(states);
+}
+
+void synchronized_printer::add_completed_state()
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.add_completed_state();
+}
+
+std::size_t synchronized_printer::get_completed_state_count() const
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  return m_printer.get_completed_state_count();
+}
+
+void synchronized_printer::set_total_state_count(std::size_t states)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.set_total_state_count(states);
+}
+
+std::size_t synchronized_printer::get_total_state_count() const
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  return m_printer.get_total_state_count();
+}
+
+void synchronized_printer::do_log_argv(const std::vector<std::string> &argv)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.log_argv(argv);
+}
+
+void synchronized_printer::do_print_device_info()
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.print_device_info();
+}
+
+void synchronized_printer::do_print_log_preamble()
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.print_log_preamble();
+}
+
+void synchronized_printer::do_print_log_epilogue()
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.print_log_epilogue();
+}
+
+void synchronized_printer::do_log(nvbench::log_level level, const std::string &msg)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.log(level, msg);
+}
+
+void synchronized_printer::do_log_run_state(const nvbench::state &exec_state)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.log_run_state(exec_state);
+}
+
+void synchronized_printer::do_process_bulk_data_float64(nvbench::state &state,
+                                                        const std::string &tag,
+                                                        const std::string &hint,
+                                                        const std::vector<nvbench::float64_t> &data)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.process_bulk_data(state, tag, hint, data);
+}
+
+void synchronized_printer::do_print_benchmark_list(const benchmark_vector &benches)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.print_benchmark_list(benches);
+}
+
+void synchronized_printer::do_print_benchmark_results(const benchmark_vector &benches)
+{
+  std::lock_guard<std::recursive_mutex> lock{m_mutex};
+  m_printer.print_benchmark_results(benches);
+}
+
+} // namespace nvbench::detail
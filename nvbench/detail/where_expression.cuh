@@ -0,0 +1,53 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/named_values.cuh>
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvbench::detail
+{
+
+/**
+ * Parses a `--where` filter into a predicate over a configuration's axis
+ * values, e.g. `Elements >= 1024 && T != F64`.
+ *
+ * Grammar:
+ * ```
+ * expr       := and_expr ('||' and_expr)*
+ * and_expr   := unary ('&&' unary)*
+ * unary      := '!' unary | '(' expr ')' | comparison
+ * comparison := operand ('==' | '!=' | '<' | '<=' | '>' | '>=') operand
+ * operand    := name | number | 'quoted string' | "quoted string"
+ * ```
+ *
+ * A bare name that matches one of `axis_names` refers to that axis' value in
+ * the configuration. Any other bare name is a string literal, so type axis
+ * values can be written without quotes. Each comparison must reference at
+ * least one axis. Numbers are compared numerically and strings
+ * lexicographically; comparing a string with a number throws.
+ */
+[[nodiscard]] std::function<bool(const nvbench::named_values &)>
+parse_where_expression(std::string_view expression, const std::vector<std::string> &axis_names);
+
+} // namespace nvbench::detail
@@ -0,0 +1,369 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/where_expression.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+namespace nvbench::detail
+{
+
+namespace
+{
+
+using predicate  = std::function<bool(const nvbench::named_values &)>;
+using value_type = nvbench::named_values::value_type;
+
+enum class token_kind
+{
+  end,
+  word,   // axis name or unquoted string
+  number,
+  string, // quoted
+  op,     // comparison
+  logical_and,
+  logical_or,
+  logical_not,
+  open_paren,
+  close_paren
+};
+
+struct token
+{
+  token_kind kind;
+  std::string text;
+};
+
+std::vector<token> tokenize(std::string_view expr)
+{
+  std::vector<token> tokens;
+  std::size_t pos = 0;
+  while (pos < expr.size())
+  {
+    const char c = expr[pos];
+    if (std::isspace(static_cast<unsigned char>(c)))
+    {
+      ++pos;
+      continue;
+    }
+
+    const auto two = expr.substr(pos, 2);
+    if (two == "&&" || two == "||")
+    {
+      tokens.push_back({two == "&&" ? token_kind::logical_and : token_kind::logical_or, {}});
+      pos += 2;
+    }
+    else if (two == "==" || two == "!=" || two == "<=" || two == ">=")
+    {
+      tokens.push_back({token_kind::op, std::string{two}});
+      pos += 2;
+    }
+    else if (c == '<' || c == '>')
+    {
+      tokens.push_back({token_kind::op, std::string(1, c)});
+      ++pos;
+    }
+    else if (c == '!')
+    {
+      tokens.push_back({token_kind::logical_not, {}});
+      ++pos;
+    }
+    else if (c == '(' || c == ')')
+    {
+      tokens.push_back({c == '(' ? token_kind::open_paren : token_kind::close_paren, {}});
+      ++pos;
+    }
+    else if (c == '\'' || c == '"')
+    {
+      const auto close = expr.find(c, pos + 1);
+      if (close == std::string_view::npos)
+      {
+        NVBENCH_THROW(std::runtime_error, "Unterminated string starting at offset {}.", pos);
+      }
+      tokens.push_back({token_kind::string, std::string{expr.substr(pos + 1, close - pos - 1)}});
+      pos = close + 1;
+    }
+    else if (std::isdigit(static_cast<unsigned char>(c)) || c == '-' || c == '+' || c == '.')
+    {
+      const auto first = pos;
+      while (pos < expr.size() &&
+             (std::isalnum(static_cast<unsigned char>(expr[pos])) || expr[pos] == '.' ||
+              ((expr[pos] == '-' || expr[pos] == '+') &&
+               (pos == first || expr[pos - 1] == 'e' || expr[pos - 1] == 'E'))))
+      {
+        ++pos;
+      }
+      tokens.push_back({token_kind::number, std::string{expr.substr(first, pos - first)}});
+    }
+    else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+    {
+      const auto first = pos;
+      while (pos < expr.size() &&
+             (std::isalnum(static_cast<unsigned char>(expr[pos])) || expr[pos] == '_'))
+      {
+        ++pos;
+      }
+      tokens.push_back({token_kind::word, std::string{expr.substr(first, pos - first)}});
+    }
+    else
+    {
+      NVBENCH_THROW(std::runtime_error, "Unexpected character '{}' at offset {}.", c, pos);
+    }
+  }
+  tokens.push_back({token_kind::end, {}});
+  return tokens;
+}
+
+value_type parse_number(const std::string &text)
+{
+  nvbench::int64_t int_value{};
+  const auto [end, err] = std::from_chars(text.data(), text.data() + text.size(), int_value);
+  if (err == std::errc{} && end == text.data() + text.size())
+  {
+    return int_value;
+  }
+
+  char *float_end = nullptr;
+  const nvbench::float64_t float_value = std::strtod(text.c_str(), &float_end);
+  if (float_end != text.c_str() + text.size())
+  {
+    NVBENCH_THROW(std::runtime_error, "Invalid number `{}`.", text);
+  }
+  return float_value;
+}
+
+struct operand
+{
+  bool is_axis;
+  std::string axis;
+  value_type literal;
+
+  [[nodiscard]] const value_type &resolve(const nvbench::named_values &config) const
+  {
+    return is_axis ? config.get_value(axis) : literal;
+  }
+};
+
+template <typename T>
+bool apply(const std::string &op, const T &lhs, const T &rhs)
+{
+  if (op == "==")
+  {
+    return lhs == rhs;
+  }
+  else if (op == "!=")
+  {
+    return lhs != rhs;
+  }
+  else if (op == "<")
+  {
+    return lhs < rhs;
+  }
+  else if (op == "<=")
+  {
+    return lhs <= rhs;
+  }
+  else if (op == ">")
+  {
+    return lhs > rhs;
+  }
+  return lhs >= rhs;
+}
+
+bool compare(const std::string &op, const value_type &lhs, const value_type &rhs)
+{
+  const bool lhs_string = std::holds_alternative<std::string>(lhs);
+  const bool rhs_string = std::holds_alternative<std::string>(rhs);
+  if (lhs_string && rhs_string)
+  {
+    return apply(op, std::get<std::string>(lhs), std::get<std::string>(rhs));
+  }
+  else if (lhs_string || rhs_string)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Cannot compare string `{}` with a number.",
+                  std::get<std::string>(lhs_string ? lhs : rhs));
+  }
+
+  if (std::holds_alternative<nvbench::int64_t>(lhs) &&
+      std::holds_alternative<nvbench::int64_t>(rhs))
+  {
+    return apply(op, std::get<nvbench::int64_t>(lhs), std::get<nvbench::int64_t>(rhs));
+  }
+
+  const auto to_float64 = [](const value_type &value) {
+    return std::visit(
+      [](const auto &v) -> nvbench::float64_t {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+          return 0.;
+        }
+        else
+        {
+          return static_cast<nvbench::float64_t>(v);
+        }
+      },
+      value);
+  };
+  return apply(op, to_float64(lhs), to_float64(rhs));
+}
+
+struct parser
+{
+  parser(std::vector<token> tokens, const std::vector<std::string> &axis_names)
+      : m_tokens{std::move(tokens)}
+      , m_axis_names{axis_names}
+  {}
+
+  predicate parse()
+  {
+    auto result = this->parse_or();
+    if (this->peek().kind != token_kind::end)
+    {
+      NVBENCH_THROW(std::runtime_error, "{}", "Unexpected trailing input.");
+    }
+    return result;
+  }
+
+private:
+  const token &peek() const { return m_tokens[m_pos]; }
+  const token &take() { return m_tokens[m_pos++]; }
+
+  predicate parse_or()
+  {
+    auto lhs = this->parse_and();
+    while (this->peek().kind == token_kind::logical_or)
+    {
+      this->take();
+      lhs = [lhs, rhs = this->parse_and()](const nvbench::named_values &config) {
+        return lhs(config) || rhs(config);
+      };
+    }
+    return lhs;
+  }
+
+  predicate parse_and()
+  {
+    auto lhs = this->parse_unary();
+    while (this->peek().kind == token_kind::logical_and)
+    {
+      this->take();
+      lhs = [lhs, rhs = this->parse_unary()](const nvbench::named_values &config) {
+        return lhs(config) && rhs(config);
+      };
+    }
+    return lhs;
+  }
+
+  predicate parse_unary()
+  {
+    if (this->peek().kind == token_kind::logical_not)
+    {
+      this->take();
+      return [inner = this->parse_unary()](const nvbench::named_values &config) {
+        return !inner(config);
+      };
+    }
+    if (this->peek().kind == token_kind::open_paren)
+    {
+      this->take();
+      auto inner = this->parse_or();
+      if (this->take().kind != token_kind::close_paren)
+      {
+        NVBENCH_THROW(std::runtime_error, "{}", "Expected `)`.");
+      }
+      return inner;
+    }
+    return this->parse_comparison();
+  }
+
+  predicate parse_comparison()
+  {
+    auto lhs = this->parse_operand();
+    const token &op = this->take();
+    if (op.kind != token_kind::op)
+    {
+      NVBENCH_THROW(std::runtime_error, "{}", "Expected a comparison operator.");
+    }
+    auto rhs = this->parse_operand();
+    if (!lhs.is_axis && !rhs.is_axis)
+    {
+      NVBENCH_THROW(std::runtime_error,
+                    "{}",
+                    "Each comparison must reference an axis; check the axis names.");
+    }
+
+    return [lhs = std::move(lhs), rhs = std::move(rhs), op = op.text](
+             const nvbench::named_values &config) {
+      return compare(op, lhs.resolve(config), rhs.resolve(config));
+    };
+  }
+
+  operand parse_operand()
+  {
+    const token &tok = this->take();
+    switch (tok.kind)
+    {
+      case token_kind::word:
+        if (std::find(m_axis_names.cbegin(), m_axis_names.cend(), tok.text) !=
+            m_axis_names.cend())
+        {
+          return {true, tok.text, {}};
+        }
+        return {false, {}, tok.text};
+
+      case token_kind::string:
+        return {false, {}, tok.text};
+
+      case token_kind::number:
+        return {false, {}, parse_number(tok.text)};
+
+      default:
+        NVBENCH_THROW(std::runtime_error, "{}", "Expected an axis name or value.");
+    }
+  }
+
+  std::vector<token> m_tokens;
+  const std::vector<std::string> &m_axis_names;
+  std::size_t m_pos{};
+};
+
+} // namespace
+
+std::function<bool(const nvbench::named_values &)>
+parse_where_expression(std::string_view expression, const std::vector<std::string> &axis_names)
+try
+{
+  return parser{tokenize(expression), axis_names}.parse();
+}
+catch (std::exception &e)
+{
+  NVBENCH_THROW(std::runtime_error, "Invalid expression `{}`:\n{}", expression, e.what());
+}
+
+} // namespace nvbench::detail
@@ -0,0 +1,92 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace nvbench
+{
+struct benchmark_base;
+struct state;
+} // namespace nvbench
+
+namespace nvbench::detail
+{
+
+/*!
+ * A child process that runs states on behalf of the benchmark (`--isolate`),
+ * so that a crashing or hanging state does not take the whole run down.
+ *
+ * The worker is a fresh instance of the current executable (GPU runtimes do
+ * not survive `fork`), started with the same arguments plus
+ * `--isolate-worker <benchmark index> <fd>`. It generates the same states as
+ * this process and runs the ones it is asked for by index, see
+ * `serve_worker_states`; the worker's `main` dispatches there using
+ * `option_parser::get_isolate_worker`. Log messages and bulk data are
+ * forwarded to the benchmark's printer while the state runs, and its summaries
+ * and skip reason are copied back once it completes.
+ *
+ * Only supported on Linux.
+ */
+struct worker_process
+{
+  /// Starts the worker. `args` is its command line, including `argv[0]` and
+  /// `--isolate-worker <benchmark index>`; the file descriptor is appended.
+  explicit worker_process(const std::vector<std::string> &args);
+  ~worker_process();
+
+  worker_process(const worker_process &)            = delete;
+  worker_process &operator=(const worker_process &) = delete;
+
+  /// Runs the worker's copy of `exec_state`, which has index `index` in the
+  /// benchmark's states, with `exec_state`'s timeout and convergence criteria.
+  ///
+  /// If the worker dies, or the state runs for more than `watchdog_time`,
+  /// the worker is killed and a description of what happened is returned.
+  /// The worker can not be used after that.
+  [[nodiscard]] std::optional<std::string> run_state(std::size_t index,
+                                                     nvbench::state &exec_state);
+
+  /// Seconds a state may run in the worker before it is considered hung:
+  /// its cold and batch measurements may each use the full timeout.
+  [[nodiscard]] static nvbench::float64_t watchdog_time(const nvbench::state &exec_state);
+
+private:
+  [[nodiscard]] std::string wait_for_exit(bool kill);
+
+  int m_pid{-1};
+  int m_fd{-1};
+};
+
+/// Entry point of a worker process started by `worker_process`. Serves
+/// requests read from `fd` by passing the index of each requested state to
+/// `execute_state`, until the connection is closed. `bench`'s printer is
+/// replaced by one that forwards to the requesting process.
+void serve_worker_states(int fd,
+                         nvbench::benchmark_base &bench,
+                         std::vector<nvbench::state> &states,
+                         const std::function<void(std::size_t)> &execute_state);
+
+} // namespace nvbench::detail
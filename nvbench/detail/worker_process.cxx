@@ -0,0 +1,562 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/detail/worker_process.cuh>
+
+#include <nvbench/benchmark_base.cuh>
+#include <nvbench/printer_base.cuh>
+#include <nvbench/state.cuh>
+#include <nvbench/summary.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#ifdef __linux__
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace nvbench::detail
+{
+
+nvbench::float64_t worker_process::watchdog_time(const nvbench::state &exec_state)
+{
+  // The rest covers warmups, setup and teardown:
+  return 2. * exec_state.get_timeout() + 60.;
+}
+
+#ifdef __linux__
+
+namespace
+{
+
+enum class message_type : std::uint8_t
+{
+  run_state,    // To the worker: index and criteria of the state to run.
+  log,          // From the worker: a `printer_base::log` call.
+  bulk_data,    // From the worker: a `printer_base::process_bulk_data` call.
+  state_results // From the worker: skip reason and summaries of the state.
+};
+
+// Fields are appended with `put` and read back in the same order with `get`.
+// Both ends run the same executable on the same machine, so values are copied
+// in native byte order.
+struct message
+{
+  message_type type{};
+  std::vector<char> data;
+  std::size_t read_pos{0};
+
+  template <typename T>
+  void put(T value)
+  {
+    const auto *bytes = reinterpret_cast<const char *>(&value);
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+  }
+
+  void put_string(std::string_view str)
+  {
+    this->put(static_cast<std::uint64_t>(str.size()));
+    data.insert(data.end(), str.cbegin(), str.cend());
+  }
+
+  template <typename T>
+  T get()
+  {
+    T value;
+    std::memcpy(&value, this->take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  std::string get_string()
+  {
+    const auto size = static_cast<std::size_t>(this->get<std::uint64_t>());
+    return std::string(this->take(size), size);
+  }
+
+  const char *take(std::size_t size)
+  {
+    if (data.size() - read_pos < size)
+    {
+      NVBENCH_THROW(std::runtime_error, "{}", "Truncated message from worker process.");
+    }
+    const char *result = data.data() + read_pos;
+    read_pos += size;
+    return result;
+  }
+};
+
+void put_summary(message &msg, const nvbench::summary &summ)
+{
+  msg.put_string(summ.get_tag());
+  const auto names = summ.get_names();
+  msg.put(static_cast<std::uint64_t>(names.size()));
+  for (const auto &name : names)
+  {
+    msg.put_string(name);
+    const auto type = summ.get_type(name);
+    msg.put(static_cast<std::uint8_t>(type));
+    switch (type)
+    {
+      case nvbench::named_values::type::int64:
+        msg.put(summ.get_int64(name));
+        break;
+      case nvbench::named_values::type::float64:
+        msg.put(summ.get_float64(name));
+        break;
+      case nvbench::named_values::type::string:
+        msg.put_string(summ.get_string(name));
+        break;
+    }
+  }
+}
+
+nvbench::summary get_summary(message &msg)
+{
+  nvbench::summary summ{msg.get_string()};
+  const auto count = msg.get<std::uint64_t>();
+  for (std::uint64_t i = 0; i < count; ++i)
+  {
+    auto name = msg.get_string();
+    switch (static_cast<nvbench::named_values::type>(msg.get<std::uint8_t>()))
+    {
+      case nvbench::named_values::type::int64:
+        summ.set_int64(std::move(name), msg.get<nvbench::int64_t>());
+        break;
+      case nvbench::named_values::type::float64:
+        summ.set_float64(std::move(name), msg.get<nvbench::float64_t>());
+        break;
+      case nvbench::named_values::type::string:
+        summ.set_string(std::move(name), msg.get_string());
+        break;
+      default:
+        NVBENCH_THROW(std::runtime_error, "{}", "Unrecognized value type.");
+    }
+  }
+  return summ;
+}
+
+// Returns false if the connection is closed.
+bool send_all(int fd, const char *data, std::size_t size)
+{
+  while (size > 0)
+  {
+    // MSG_NOSIGNAL: report a closed connection as EPIPE instead of raising
+    // SIGPIPE.
+    const auto sent = ::send(fd, data, size, MSG_NOSIGNAL);
+    if (sent < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      if (errno == EPIPE || errno == ECONNRESET)
+      {
+        return false;
+      }
+      NVBENCH_THROW(std::runtime_error, "Failed to send message: {}", std::strerror(errno));
+    }
+    data += sent;
+    size -= static_cast<std::size_t>(sent);
+  }
+  return true;
+}
+
+bool send_message(int fd, const message &msg)
+{
+  char header[sizeof(std::uint8_t) + sizeof(std::uint64_t)];
+  const auto type = static_cast<std::uint8_t>(msg.type);
+  const auto size = static_cast<std::uint64_t>(msg.data.size());
+  std::memcpy(header, &type, sizeof(type));
+  std::memcpy(header + sizeof(type), &size, sizeof(size));
+  return send_all(fd, header, sizeof(header)) && send_all(fd, msg.data.data(), msg.data.size());
+}
+
+using clock_type = std::chrono::steady_clock;
+
+enum class receive_status
+{
+  ok,
+  closed,
+  timed_out
+};
+
+receive_status
+receive_all(int fd, char *data, std::size_t size, std::optional<clock_type::time_point> deadline)
+{
+  while (size > 0)
+  {
+    if (deadline)
+    {
+      const auto remaining =
+        std::chrono::duration_cast<std::chrono::milliseconds>(*deadline - clock_type::now())
+          .count();
+      if (remaining <= 0)
+      {
+        return receive_status::timed_out;
+      }
+      pollfd poll_fd{fd, POLLIN, 0};
+      const int ready =
+        ::poll(&poll_fd, 1, static_cast<int>(std::min<decltype(remaining)>(remaining, INT_MAX)));
+      if (ready < 0 && errno != EINTR)
+      {
+        NVBENCH_THROW(std::runtime_error,
+                      "Failed to poll worker process: {}",
+                      std::strerror(errno));
+      }
+      if (ready <= 0)
+      {
+        continue;
+      }
+    }
+
+    const auto received = ::recv(fd, data, size, 0);
+    if (received < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (received <= 0)
+    {
+      return receive_status::closed;
+    }
+    data += received;
+    size -= static_cast<std::size_t>(received);
+  }
+  return receive_status::ok;
+}
+
+receive_status
+receive_message(int fd, message &msg, std::optional<clock_type::time_point> deadline = {})
+{
+  char header[sizeof(std::uint8_t) + sizeof(std::uint64_t)];
+  if (const auto status = receive_all(fd, header, sizeof(header), deadline);
+      status != receive_status::ok)
+  {
+    return status;
+  }
+
+  std::uint8_t type{};
+  std::uint64_t size{};
+  std::memcpy(&type, header, sizeof(type));
+  std::memcpy(&size, header + sizeof(type), sizeof(size));
+  msg.type     = static_cast<message_type>(type);
+  msg.read_pos = 0;
+  msg.data.resize(static_cast<std::size_t>(size));
+  return receive_all(fd, msg.data.data(), msg.data.size(), deadline);
+}
+
+// Installed as the benchmark's printer in the worker process:
+struct worker_printer : nvbench::printer_base
+{
+  explicit worker_printer(int fd)
+      : printer_base(std::cerr) // Nothing should write to this.
+      , m_fd{fd}
+  {}
+
+protected:
+  void do_log(nvbench::log_level level, const std::string &msg) override
+  {
+    message forwarded{message_type::log, {}};
+    forwarded.put(static_cast<std::uint8_t>(level));
+    forwarded.put_string(msg);
+    this->send(forwarded);
+  }
+
+  void do_process_bulk_data_float64(nvbench::state &,
+                                    const std::string &tag,
+                                    const std::string &hint,
+                                    const std::vector<nvbench::float64_t> &data) override
+  {
+    message forwarded{message_type::bulk_data, {}};
+    forwarded.put_string(tag);
+    forwarded.put_string(hint);
+    forwarded.put(static_cast<std::uint64_t>(data.size()));
+    const auto *bytes = reinterpret_cast<const char *>(data.data());
+    forwarded.data.insert(forwarded.data.end(), bytes, bytes + data.size() * sizeof(data[0]));
+    this->send(forwarded);
+  }
+
+  void send(const message &msg)
+  {
+    if (!send_message(m_fd, msg))
+    {
+      NVBENCH_THROW(std::runtime_error, "{}", "Lost connection to the benchmark process.");
+    }
+  }
+
+  int m_fd;
+};
+
+} // namespace
+
+worker_process::worker_process(const std::vector<std::string> &args)
+{
+  int fds[2];
+  if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Failed to create a connection to a worker process: {}",
+                  std::strerror(errno));
+  }
+
+  // Only async-signal-safe calls may be made between `fork` and `exec`, so
+  // prepare the worker's arguments up front:
+  std::vector<std::string> worker_args = args;
+  worker_args.push_back(fmt::to_string(fds[1]));
+  std::vector<char *> argv;
+  argv.reserve(worker_args.size() + 1);
+  for (auto &arg : worker_args)
+  {
+    argv.push_back(arg.data());
+  }
+  argv.push_back(nullptr);
+
+  // The worker would otherwise write out a copy of anything still buffered:
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  const pid_t pid = ::fork();
+  if (pid < 0)
+  {
+    const int error = errno;
+    ::close(fds[0]);
+    ::close(fds[1]);
+    NVBENCH_THROW(std::runtime_error, "Failed to start a worker process: {}", std::strerror(error));
+  }
+  if (pid == 0)
+  {
+    // Keep the worker's end open across exec:
+    ::fcntl(fds[1], F_SETFD, 0);
+    ::execv("/proc/self/exe", argv.data());
+    ::_exit(127);
+  }
+
+  ::close(fds[1]);
+  m_pid = pid;
+  m_fd  = fds[0];
+}
+
+worker_process::~worker_process()
+{
+  if (m_pid > 0)
+  {
+    // Closing the connection asks the worker to exit:
+    (void)this->wait_for_exit(false);
+  }
+}
+
+std::optional<std::string> worker_process::run_state(std::size_t index,
+                                                     nvbench::state &exec_state)
+{
+  message request{message_type::run_state, {}};
+  request.put(static_cast<std::uint64_t>(index));
+  request.put(exec_state.get_timeout());
+  request.put(exec_state.get_min_time());
+  request.put(exec_state.get_max_noise());
+  if (!send_message(m_fd, request))
+  {
+    return this->wait_for_exit(false);
+  }
+
+  const nvbench::float64_t watchdog = worker_process::watchdog_time(exec_state);
+  const auto deadline =
+    clock_type::now() + std::chrono::duration_cast<clock_type::duration>(
+                          std::chrono::duration<nvbench::float64_t>(watchdog));
+  const auto printer_opt_ref = exec_state.get_benchmark().get_printer();
+
+  message msg;
+  while (true)
+  {
+    const auto status = receive_message(m_fd, msg, deadline);
+    if (status == receive_status::timed_out)
+    {
+      (void)this->wait_for_exit(true);
+      return fmt::format("Worker process timed out after {:.2f}s.", watchdog);
+    }
+    if (status == receive_status::closed)
+    {
+      return this->wait_for_exit(false);
+    }
+
+    switch (msg.type)
+    {
+      case message_type::log: {
+        const auto level = static_cast<nvbench::log_level>(msg.get<std::uint8_t>());
+        const auto text  = msg.get_string();
+        if (printer_opt_ref.has_value())
+        {
+          printer_opt_ref.value().get().log(level, text);
+        }
+        break;
+      }
+
+      case message_type::bulk_data: {
+        const auto tag   = msg.get_string();
+        const auto hint  = msg.get_string();
+        const auto count = static_cast<std::size_t>(msg.get<std::uint64_t>());
+        std::vector<nvbench::float64_t> data(count);
+        const char *bytes = msg.take(count * sizeof(data[0]));
+        std::copy(bytes, bytes + count * sizeof(data[0]), reinterpret_cast<char *>(data.data()));
+        if (printer_opt_ref.has_value())
+        {
+          printer_opt_ref.value().get().process_bulk_data(exec_state, tag, hint, data);
+        }
+        break;
+      }
+
+      case message_type::state_results: {
+        if (auto skip_reason = msg.get_string(); !skip_reason.empty())
+        {
+          exec_state.skip(std::move(skip_reason));
+        }
+        const auto count = msg.get<std::uint64_t>();
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+          exec_state.add_summary(get_summary(msg));
+        }
+        return std::nullopt;
+      }
+
+      default:
+        NVBENCH_THROW(std::runtime_error,
+                      "Unexpected message from worker process: {}",
+                      static_cast<int>(msg.type));
+    }
+  }
+}
+
+std::string worker_process::wait_for_exit(bool kill)
+{
+  if (kill)
+  {
+    ::kill(m_pid, SIGKILL);
+  }
+  ::close(m_fd);
+  m_fd = -1;
+
+  int status = 0;
+  while (::waitpid(m_pid, &status, 0) < 0 && errno == EINTR)
+  {}
+  m_pid = -1;
+
+  if (WIFSIGNALED(status))
+  {
+    const int signal = WTERMSIG(status);
+    return fmt::format("Worker process was terminated by signal {} ({}).",
+                       signal,
+                       ::strsignal(signal));
+  }
+  return fmt::format("Worker process exited with code {}.", WEXITSTATUS(status));
+}
+
+void serve_worker_states(int fd,
+                         nvbench::benchmark_base &bench,
+                         std::vector<nvbench::state> &states,
+                         const std::function<void(std::size_t)> &execute_state)
+{
+  worker_printer printer{fd};
+  bench.set_printer(printer);
+
+  message request;
+  while (receive_message(fd, request) == receive_status::ok)
+  {
+    if (request.type != message_type::run_state)
+    {
+      NVBENCH_THROW(std::runtime_error,
+                    "Unexpected message from benchmark process: {}",
+                    static_cast<int>(request.type));
+    }
+    const auto index = static_cast<std::size_t>(request.get<std::uint64_t>());
+    if (index >= states.size())
+    {
+      NVBENCH_THROW(std::runtime_error,
+                    "Requested state {} of a benchmark with {} states.",
+                    index,
+                    states.size());
+    }
+
+    auto &exec_state = states[index];
+    exec_state.set_timeout(request.get<nvbench::float64_t>());
+    exec_state.set_min_time(request.get<nvbench::float64_t>());
+    exec_state.set_max_noise(request.get<nvbench::float64_t>());
+    execute_state(index);
+
+    message results{message_type::state_results, {}};
+    results.put_string(exec_state.get_skip_reason());
+    const auto &summaries = exec_state.get_summaries();
+    results.put(static_cast<std::uint64_t>(summaries.size()));
+    for (const auto &summ : summaries)
+    {
+      put_summary(results, summ);
+    }
+    if (!send_message(fd, results))
+    {
+      break;
+    }
+  }
+
+  bench.clear_printer();
+  ::close(fd);
+}
+
+#else // __linux__
+
+worker_process::worker_process(const std::vector<std::string> &)
+{
+  NVBENCH_THROW(std::runtime_error, "{}", "`--isolate` is only supported on Linux.");
+}
+
+worker_process::~worker_process() = default;
+
+std::optional<std::string> worker_process::run_state(std::size_t, nvbench::state &)
+{
+  return std::nullopt;
+}
+
+std::string worker_process::wait_for_exit(bool) { return {}; }
+
+void serve_worker_states(int,
+                         nvbench::benchmark_base &,
+                         std::vector<nvbench::state> &,
+                         const std::function<void(std::size_t)> &)
+{
+  NVBENCH_THROW(std::runtime_error, "{}", "`--isolate` is only supported on Linux.");
+}
+
+#endif // __linux__
+
+} // namespace nvbench::detail
@@ -44,7 +44,8 @@
 
 #include <hip/hip_runtime_api.h>
 
-#include <cstdint> // CHAR_BIT
+#include <climits> // CHAR_BIT
+#include <cstdint>
 #include <stdexcept>
 #include <string_view>
 #include <utility>
@@ -38,7 +38,10 @@
 #pragma once
 
 #include <nvbench/device_info.cuh>
+#include <nvbench/timer_calibration.cuh>
 
+#include <mutex>
+#include <optional>
 #include <vector>
 
 namespace nvbench
@@ -88,6 +91,22 @@ struct device_manager
    */
   [[nodiscard]] const device_info_vector &get_used_devices() const { return m_used_devices; }
 
+  /**
+   * @return The timer overheads measured on `device`. The calibration runs
+   * the first time a device is requested and is cached afterwards.
+   */
+  [[nodiscard]] const nvbench::timer_calibration &
+  get_timer_calibration(const nvbench::device_info &device);
+
+  /**
+   * @return The `cpu_timer` overhead for host-only measurements. The
+   * calibration runs on the first call and is cached afterwards.
+   */
+  [[nodiscard]] const nvbench::timer_calibration &get_host_timer_calibration();
+
+  /// Number of samples used by each timer calibration.
+  static constexpr nvbench::int64_t timer_calibration_samples = 256;
+
 private:
   device_manager();
 
@@ -97,6 +116,10 @@ private:
 
   device_info_vector m_devices;
   device_info_vector m_used_devices;
+
+  std::mutex m_calibration_mutex;
+  std::optional<nvbench::timer_calibration> m_host_calibration;
+  std::vector<std::optional<nvbench::timer_calibration>> m_device_calibrations;
 };
 
 } // namespace nvbench
@@ -59,7 +59,8 @@ enum class exec_flag
   // Measurement types:
   cold         = 0x0100, // measure_hot
   hot          = 0x0200, // measure_cold
-  measure_mask = cold | hot
+  cpu          = 0x0400, // measure_cpu
+  measure_mask = cold | hot | cpu
 };
 
 } // namespace nvbench::detail
@@ -116,6 +117,7 @@ using sync_t          = tag<nvbench::detail::exec_flag::sync>;
 using run_once_t      = tag<nvbench::detail::exec_flag::run_once>;
 using hot_t           = tag<nvbench::detail::exec_flag::hot>;
 using cold_t          = tag<nvbench::detail::exec_flag::cold>;
+using cpu_t           = tag<nvbench::detail::exec_flag::cpu>;
 using modifier_mask_t = tag<nvbench::detail::exec_flag::modifier_mask>;
 using measure_mask_t  = tag<nvbench::detail::exec_flag::measure_mask>;
 
@@ -126,6 +128,7 @@ constexpr inline sync_t sync;
 constexpr inline run_once_t run_once;
 constexpr inline cold_t cold;
 constexpr inline hot_t hot;
+constexpr inline cpu_t cpu;
 constexpr inline modifier_mask_t modifier_mask;
 constexpr inline measure_mask_t measure_mask;
 
@@ -141,4 +144,9 @@ constexpr inline auto timer = nvbench::exec_tag::impl::timer;
 /// synchronizations. Without this flag such benchmarks will deadlock.
 constexpr inline auto sync = nvbench::exec_tag::impl::no_block | nvbench::exec_tag::impl::sync;
 
+/// Measure the KernelLauncher with a host CPU timer only. No device, stream,
+/// or events are used, so this works for benchmarks without devices (see
+/// `benchmark_base::clear_devices`). May be combined with `timer`.
+constexpr inline auto cpu = nvbench::exec_tag::impl::cpu;
+
 } // namespace nvbench::exec_tag
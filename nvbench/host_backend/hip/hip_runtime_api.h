@@ -0,0 +1,122 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+// Simulated-device implementation of the subset of the HIP runtime API used by
+// NVBench. This header is only on the include path when NVBench is configured
+// with `NVBench_BACKEND=HOST`; see nvbench/host_backend/hip_runtime.cxx.
+
+#include <cstddef>
+
+struct ihipStream_t;
+struct ihipEvent_t;
+
+using hipStream_t = ihipStream_t *;
+using hipEvent_t  = ihipEvent_t *;
+
+using hipHostFn_t = void (*)(void *user_data);
+
+enum hipError_t
+{
+  hipSuccess             = 0,
+  hipErrorInvalidValue   = 1,
+  hipErrorOutOfMemory    = 2,
+  hipErrorNoDevice       = 100,
+  hipErrorInvalidDevice  = 101,
+  hipErrorInvalidHandle  = 400,
+  hipErrorNotReady       = 600,
+  hipErrorNotSupported   = 801,
+};
+
+enum hipDeviceAttribute_t
+{
+  hipDeviceAttributeL2CacheSize,
+};
+
+enum : unsigned int
+{
+  hipHostRegisterDefault = 0x0,
+  hipHostRegisterMapped  = 0x2,
+};
+
+struct hipDeviceProp_t
+{
+  char name[256];
+  char gcnArchName[256];
+  std::size_t totalGlobalMem;
+  std::size_t sharedMemPerBlock;
+  std::size_t sharedMemPerMultiprocessor;
+  int regsPerBlock;
+  int regsPerMultiprocessor;
+  int warpSize;
+  int maxThreadsPerBlock;
+  int maxThreadsPerMultiProcessor;
+  int maxBlocksPerMultiProcessor;
+  int clockRate;        // kHz
+  int memoryClockRate;  // kHz
+  int memoryBusWidth;   // bits
+  int major;
+  int minor;
+  int multiProcessorCount;
+  int l2CacheSize;
+  int ECCEnabled;
+};
+
+struct hipFuncAttributes
+{
+  int binaryVersion;
+  int ptxVersion;
+};
+
+// Errors:
+const char *hipGetErrorName(hipError_t error);
+const char *hipGetErrorString(hipError_t error);
+
+// Devices:
+hipError_t hipGetDeviceCount(int *count);
+hipError_t hipGetDevice(int *device);
+hipError_t hipSetDevice(int device);
+hipError_t hipGetDeviceProperties(hipDeviceProp_t *prop, int device);
+hipError_t hipDeviceGetAttribute(int *value, hipDeviceAttribute_t attr, int device);
+hipError_t hipDeviceSynchronize();
+hipError_t hipDeviceReset();
+hipError_t hipMemGetInfo(std::size_t *free, std::size_t *total);
+hipError_t hipFuncGetAttributes(hipFuncAttributes *attr, const void *func);
+
+// Streams:
+hipError_t hipStreamCreate(hipStream_t *stream);
+hipError_t hipStreamDestroy(hipStream_t stream);
+hipError_t hipStreamSynchronize(hipStream_t stream);
+hipError_t hipLaunchHostFunc(hipStream_t stream, hipHostFn_t fn, void *user_data);
+
+// Events:
+hipError_t hipEventCreate(hipEvent_t *event);
+hipError_t hipEventDestroy(hipEvent_t event);
+hipError_t hipEventRecord(hipEvent_t event, hipStream_t stream = nullptr);
+hipError_t hipEventQuery(hipEvent_t event);
+hipError_t hipEventSynchronize(hipEvent_t event);
+hipError_t hipEventElapsedTime(float *ms, hipEvent_t start, hipEvent_t stop);
+
+// Memory:
+hipError_t hipMalloc(void **ptr, std::size_t size);
+hipError_t hipFree(void *ptr);
+hipError_t hipMemsetAsync(void *dst, int value, std::size_t size, hipStream_t stream = nullptr);
+hipError_t hipHostRegister(void *host_ptr, std::size_t size, unsigned int flags);
+hipError_t hipHostUnregister(void *host_ptr);
+hipError_t hipHostGetDevicePointer(void **device_ptr, void *host_ptr, unsigned int flags);
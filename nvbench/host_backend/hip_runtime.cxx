@@ -0,0 +1,572 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Simulated device for NVBench's HOST backend.
+//
+// Implements the subset of the HIP runtime API used by NVBench on top of
+// standard threads and a monotonic clock, so that the library, printers and
+// measurement loops can be built and tested on machines without a GPU
+// runtime:
+//
+// - Each stream owns a worker thread that executes enqueued work in order.
+//   The null stream is a separate, process-wide stream; unlike HIP's legacy
+//   default stream it does not synchronize with other streams.
+// - Events are timestamped with `std::chrono::steady_clock` when the stream
+//   reaches them.
+// - Device memory is host memory. Memsets are executed on the stream.
+// - A single device with fixed, plausible properties is reported.
+
+#include <hip/hip_runtime_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct ihipStream_t
+{
+  ihipStream_t()
+      : m_worker{[this]() { this->run(); }}
+  {}
+
+  ~ihipStream_t()
+  {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_shutdown = true;
+    }
+    m_work_cv.notify_all();
+    m_worker.join();
+  }
+
+  ihipStream_t(const ihipStream_t &)            = delete;
+  ihipStream_t(ihipStream_t &&)                 = delete;
+  ihipStream_t &operator=(const ihipStream_t &) = delete;
+  ihipStream_t &operator=(ihipStream_t &&)      = delete;
+
+  void enqueue(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_tasks.push_back(std::move(task));
+      ++m_pending;
+    }
+    m_work_cv.notify_one();
+  }
+
+  void synchronize()
+  {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_idle_cv.wait(lock, [this]() { return m_pending == 0; });
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true)
+    {
+      m_work_cv.wait(lock, [this]() { return m_shutdown || !m_tasks.empty(); });
+      if (m_tasks.empty())
+      { // Shutting down and all work has drained.
+        return;
+      }
+
+      auto task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+
+      lock.unlock();
+      task();
+      lock.lock();
+
+      if (--m_pending == 0)
+      {
+        m_idle_cv.notify_all();
+      }
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_work_cv;
+  std::condition_variable m_idle_cv;
+  std::deque<std::function<void()>> m_tasks;
+  std::size_t m_pending{};
+  bool m_shutdown{false};
+
+  // Must be last so that the members above are initialized before the worker
+  // starts:
+  std::thread m_worker;
+};
+
+struct ihipEvent_t
+{
+  using clock = std::chrono::steady_clock;
+
+  // Returns a ticket that identifies this recording.
+  std::uint64_t record()
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return ++m_recorded;
+  }
+
+  void complete(std::uint64_t ticket)
+  {
+    const auto now = clock::now();
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_timestamp = now;
+      m_completed = ticket;
+    }
+    m_cv.notify_all();
+  }
+
+  bool query()
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_completed == m_recorded;
+  }
+
+  void synchronize()
+  {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    const auto ticket = m_recorded;
+    m_cv.wait(lock, [this, ticket]() { return m_completed >= ticket; });
+  }
+
+  // Returns false if the event has not completed.
+  bool get_timestamp(clock::time_point &timestamp)
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_completed == 0 || m_completed != m_recorded)
+    {
+      return false;
+    }
+    timestamp = m_timestamp;
+    return true;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::uint64_t m_recorded{};
+  std::uint64_t m_completed{};
+  clock::time_point m_timestamp{};
+};
+
+namespace
+{
+
+// The number of simulated devices, from NVBENCH_HOST_DEVICES (default 1). They
+// all share the host's cores and memory.
+int get_num_simulated_devices()
+{
+  static const int num_devices = []() {
+    const char *env = std::getenv("NVBENCH_HOST_DEVICES");
+    const int num   = env ? std::atoi(env) : 1;
+    return std::max(1, num);
+  }();
+  return num_devices;
+}
+
+thread_local int current_device = 0;
+
+// Tracks all live streams for hipDeviceSynchronize.
+struct stream_registry
+{
+  static stream_registry &get()
+  {
+    static stream_registry registry;
+    return registry;
+  }
+
+  ihipStream_t &null_stream() { return m_null_stream; }
+
+  void add(ihipStream_t *stream, int device)
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_streams.push_back({stream, device});
+  }
+
+  bool remove(ihipStream_t *stream)
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto iter = std::find_if(m_streams.begin(), m_streams.end(), [stream](const auto &entry) {
+      return entry.first == stream;
+    });
+    if (iter == m_streams.end())
+    {
+      return false;
+    }
+    m_streams.erase(iter);
+    return true;
+  }
+
+  // Simulated devices are independent, so this only waits for `device`'s
+  // streams (and the shared null stream).
+  void synchronize_all(int device)
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (auto &[stream, stream_device] : m_streams)
+    {
+      if (stream_device == device)
+      {
+        stream->synchronize();
+      }
+    }
+    m_null_stream.synchronize();
+  }
+
+private:
+  std::mutex m_mutex;
+  std::vector<std::pair<ihipStream_t *, int>> m_streams;
+  ihipStream_t m_null_stream;
+};
+
+ihipStream_t &get_stream(hipStream_t stream)
+{
+  return stream ? *stream : stream_registry::get().null_stream();
+}
+
+hipDeviceProp_t make_device_properties()
+{
+  hipDeviceProp_t prop{};
+  std::strncpy(prop.name, "NVBench Host Simulated Device", sizeof(prop.name) - 1);
+  std::strncpy(prop.gcnArchName, "host", sizeof(prop.gcnArchName) - 1);
+  prop.totalGlobalMem             = std::size_t{8} << 30;
+  prop.sharedMemPerBlock          = std::size_t{64} << 10;
+  prop.sharedMemPerMultiprocessor = std::size_t{64} << 10;
+  prop.regsPerBlock               = 65536;
+  prop.regsPerMultiprocessor      = 65536;
+  prop.warpSize                   = 1;
+  prop.maxThreadsPerBlock         = 1;
+  prop.maxThreadsPerMultiProcessor = 1;
+  prop.maxBlocksPerMultiProcessor = 1;
+  prop.clockRate                  = 1'000'000;
+  prop.memoryClockRate            = 1'600'000;
+  prop.memoryBusWidth             = 64;
+  prop.major                      = 0;
+  prop.minor                      = 0;
+  prop.multiProcessorCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  prop.l2CacheSize         = 4 << 20;
+  prop.ECCEnabled          = 0;
+  return prop;
+}
+
+const hipDeviceProp_t &get_device_properties()
+{
+  static const hipDeviceProp_t prop = make_device_properties();
+  return prop;
+}
+
+bool is_valid_device(int device) { return device >= 0 && device < get_num_simulated_devices(); }
+
+} // namespace
+
+const char *hipGetErrorName(hipError_t error)
+{
+  switch (error)
+  {
+    case hipSuccess: return "hipSuccess";
+    case hipErrorInvalidValue: return "hipErrorInvalidValue";
+    case hipErrorOutOfMemory: return "hipErrorOutOfMemory";
+    case hipErrorNoDevice: return "hipErrorNoDevice";
+    case hipErrorInvalidDevice: return "hipErrorInvalidDevice";
+    case hipErrorInvalidHandle: return "hipErrorInvalidHandle";
+    case hipErrorNotReady: return "hipErrorNotReady";
+    case hipErrorNotSupported: return "hipErrorNotSupported";
+  }
+  return "hipErrorUnknown";
+}
+
+const char *hipGetErrorString(hipError_t error)
+{
+  switch (error)
+  {
+    case hipSuccess: return "no error";
+    case hipErrorInvalidValue: return "invalid argument";
+    case hipErrorOutOfMemory: return "out of memory";
+    case hipErrorNoDevice: return "no simulated device available";
+    case hipErrorInvalidDevice: return "invalid device ordinal";
+    case hipErrorInvalidHandle: return "invalid resource handle";
+    case hipErrorNotReady: return "device not ready";
+    case hipErrorNotSupported: return "operation not supported by the host backend";
+  }
+  return "unknown error";
+}
+
+hipError_t hipGetDeviceCount(int *count)
+{
+  if (!count)
+  {
+    return hipErrorInvalidValue;
+  }
+  *count = get_num_simulated_devices();
+  return hipSuccess;
+}
+
+hipError_t hipGetDevice(int *device)
+{
+  if (!device)
+  {
+    return hipErrorInvalidValue;
+  }
+  *device = current_device;
+  return hipSuccess;
+}
+
+hipError_t hipSetDevice(int device)
+{
+  if (!is_valid_device(device))
+  {
+    return hipErrorInvalidDevice;
+  }
+  current_device = device;
+  return hipSuccess;
+}
+
+hipError_t hipGetDeviceProperties(hipDeviceProp_t *prop, int device)
+{
+  if (!prop)
+  {
+    return hipErrorInvalidValue;
+  }
+  if (!is_valid_device(device))
+  {
+    return hipErrorInvalidDevice;
+  }
+  *prop = get_device_properties();
+  return hipSuccess;
+}
+
+hipError_t hipDeviceGetAttribute(int *value, hipDeviceAttribute_t attr, int device)
+{
+  if (!value)
+  {
+    return hipErrorInvalidValue;
+  }
+  if (!is_valid_device(device))
+  {
+    return hipErrorInvalidDevice;
+  }
+  switch (attr)
+  {
+    case hipDeviceAttributeL2CacheSize: *value = get_device_properties().l2CacheSize; return hipSuccess;
+  }
+  return hipErrorInvalidValue;
+}
+
+hipError_t hipDeviceSynchronize()
+{
+  stream_registry::get().synchronize_all(current_device);
+  return hipSuccess;
+}
+
+hipError_t hipDeviceReset()
+{
+  stream_registry::get().synchronize_all(current_device);
+  return hipSuccess;
+}
+
+hipError_t hipMemGetInfo(std::size_t *free, std::size_t *total)
+{
+  if (!free || !total)
+  {
+    return hipErrorInvalidValue;
+  }
+  *total = get_device_properties().totalGlobalMem;
+  *free  = *total;
+  return hipSuccess;
+}
+
+hipError_t hipFuncGetAttributes(hipFuncAttributes *attr, const void *func)
+{
+  if (!attr || !func)
+  {
+    return hipErrorInvalidValue;
+  }
+  const auto &prop    = get_device_properties();
+  attr->binaryVersion = prop.major * 10 + prop.minor;
+  attr->ptxVersion    = attr->binaryVersion;
+  return hipSuccess;
+}
+
+hipError_t hipStreamCreate(hipStream_t *stream)
+{
+  if (!stream)
+  {
+    return hipErrorInvalidValue;
+  }
+  *stream = new ihipStream_t;
+  stream_registry::get().add(*stream, current_device);
+  return hipSuccess;
+}
+
+hipError_t hipStreamDestroy(hipStream_t stream)
+{
+  if (!stream || !stream_registry::get().remove(stream))
+  {
+    return hipErrorInvalidHandle;
+  }
+  delete stream; // Drains outstanding work.
+  return hipSuccess;
+}
+
+hipError_t hipStreamSynchronize(hipStream_t stream)
+{
+  get_stream(stream).synchronize();
+  return hipSuccess;
+}
+
+hipError_t hipLaunchHostFunc(hipStream_t stream, hipHostFn_t fn, void *user_data)
+{
+  if (!fn)
+  {
+    return hipErrorInvalidValue;
+  }
+  get_stream(stream).enqueue([fn, user_data]() { fn(user_data); });
+  return hipSuccess;
+}
+
+hipError_t hipEventCreate(hipEvent_t *event)
+{
+  if (!event)
+  {
+    return hipErrorInvalidValue;
+  }
+  *event = new ihipEvent_t;
+  return hipSuccess;
+}
+
+hipError_t hipEventDestroy(hipEvent_t event)
+{
+  if (!event)
+  {
+    return hipErrorInvalidHandle;
+  }
+  // The stream may still reference the event; wait for it before freeing.
+  event->synchronize();
+  delete event;
+  return hipSuccess;
+}
+
+hipError_t hipEventRecord(hipEvent_t event, hipStream_t stream)
+{
+  if (!event)
+  {
+    return hipErrorInvalidHandle;
+  }
+  const auto ticket = event->record();
+  get_stream(stream).enqueue([event, ticket]() { event->complete(ticket); });
+  return hipSuccess;
+}
+
+hipError_t hipEventQuery(hipEvent_t event)
+{
+  if (!event)
+  {
+    return hipErrorInvalidHandle;
+  }
+  return event->query() ? hipSuccess : hipErrorNotReady;
+}
+
+hipError_t hipEventSynchronize(hipEvent_t event)
+{
+  if (!event)
+  {
+    return hipErrorInvalidHandle;
+  }
+  event->synchronize();
+  return hipSuccess;
+}
+
+hipError_t hipEventElapsedTime(float *ms, hipEvent_t start, hipEvent_t stop)
+{
+  if (!ms)
+  {
+    return hipErrorInvalidValue;
+  }
+  if (!start || !stop)
+  {
+    return hipErrorInvalidHandle;
+  }
+
+  ihipEvent_t::clock::time_point start_time;
+  ihipEvent_t::clock::time_point stop_time;
+  if (!start->get_timestamp(start_time) || !stop->get_timestamp(stop_time))
+  {
+    return hipErrorNotReady;
+  }
+
+  *ms = std::chrono::duration<float, std::milli>(stop_time - start_time).count();
+  return hipSuccess;
+}
+
+hipError_t hipMalloc(void **ptr, std::size_t size)
+{
+  if (!ptr)
+  {
+    return hipErrorInvalidValue;
+  }
+  *ptr = size == 0 ? nullptr : std::malloc(size);
+  return (size == 0 || *ptr) ? hipSuccess : hipErrorOutOfMemory;
+}
+
+hipError_t hipFree(void *ptr)
+{
+  // Device memory may still be in use by queued work:
+  stream_registry::get().synchronize_all(current_device);
+  std::free(ptr);
+  return hipSuccess;
+}
+
+hipError_t hipMemsetAsync(void *dst, int value, std::size_t size, hipStream_t stream)
+{
+  if (!dst && size != 0)
+  {
+    return hipErrorInvalidValue;
+  }
+  get_stream(stream).enqueue([dst, value, size]() { std::memset(dst, value, size); });
+  return hipSuccess;
+}
+
+hipError_t hipHostRegister(void *host_ptr, std::size_t, unsigned int)
+{
+  return host_ptr ? hipSuccess : hipErrorInvalidValue;
+}
+
+hipError_t hipHostUnregister(void *host_ptr) { return host_ptr ? hipSuccess : hipErrorInvalidValue; }
+
+hipError_t hipHostGetDevicePointer(void **device_ptr, void *host_ptr, unsigned int)
+{
+  if (!device_ptr || !host_ptr)
+  {
+    return hipErrorInvalidValue;
+  }
+  // Host and simulated device share an address space:
+  *device_ptr = host_ptr;
+  return hipSuccess;
+}
@@ -41,7 +41,12 @@
 
 #include <nvbench/types.cuh>
 
+#include <nvbench/detail/sample_file.cuh>
+
+#include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace nvbench
@@ -50,6 +55,11 @@ namespace nvbench
 /*!
  * JSON output format.
  *
+ * Each state is serialized when it completes and spooled to disk (to
+ * `<filename>.partial` when writing to a file), so memory use doesn't grow
+ * with the number of states. `print_benchmark_results` then writes the
+ * document, copying the spooled states into place.
+ *
  * All modifications to the output file should increment the semantic version
  * of the json files appropriately (see json_printer::get_json_file_version()).
  */
@@ -57,10 +67,9 @@ struct json_printer : nvbench::printer_base
 {
   using printer_base::printer_base;
 
-  json_printer(std::ostream &stream, std::string stream_name, bool enable_binary_output)
-      : printer_base(stream, std::move(stream_name))
-      , m_enable_binary_output{enable_binary_output}
-  {}
+  json_printer(std::ostream &stream, std::string stream_name, bool enable_binary_output);
+
+  ~json_printer() override;
 
   /**
    * The json schema version. Follows semantic versioning.
@@ -79,9 +88,25 @@ struct json_printer : nvbench::printer_base
   [[nodiscard]] bool get_enable_binary_output() const { return m_enable_binary_output; }
   void set_enable_binary_output(bool b) { m_enable_binary_output = b; }
 
+  /// Element type of the binary sample files. Defaults to float32.
+  /// @{
+  [[nodiscard]] nvbench::detail::sample_file_type get_binary_type() const { return m_binary_type; }
+  void set_binary_type(nvbench::detail::sample_file_type type) { m_binary_type = type; }
+  /// @}
+
+  /// If set, sample files already in `<stream>-bin/` are kept and new files
+  /// are numbered after them, since restored (`--resume`) states refer to
+  /// them. Otherwise numbering starts at 0, overwriting earlier runs' files.
+  /// @{
+  [[nodiscard]] bool get_keep_binary_files() const { return m_keep_binary_files; }
+  void set_keep_binary_files(bool b) { m_keep_binary_files = b; }
+  /// @}
+
 protected:
   // Virtual API from printer_base:
   void do_log_argv(const std::vector<std::string> &argv) override { m_argv = argv; }
+  void do_log_run_state(const nvbench::state &exec_state) override;
+  void do_add_completed_state() override;
   void do_process_bulk_data_float64(nvbench::state &state,
                                     const std::string &tag,
                                     const std::string &hint,
@@ -89,9 +114,20 @@ protected:
   void do_print_benchmark_results(const benchmark_vector &benches) override;
 
   bool m_enable_binary_output{false};
+  nvbench::detail::sample_file_type m_binary_type{nvbench::detail::sample_file_type::float32};
+  bool m_keep_binary_files{false};
   std::size_t m_num_jsonbin_files{};
+  std::string m_binary_dir;         // Created on first use
+  std::vector<char> m_binary_buffer; // Reused between sample files
 
   std::vector<std::string> m_argv;
+
+  // The state between log_run_state and add_completed_state, per thread that
+  // runs states:
+  std::unordered_map<std::thread::id, const nvbench::state *> m_running_states;
+
+  struct state_spool;
+  std::unique_ptr<state_spool> m_spool;
 };
 
 } // namespace nvbench
@@ -41,6 +41,7 @@
 #include <nvbench/benchmark_manager.cuh>
 #include <nvbench/config.cuh>
 #include <nvbench/cuda_call.cuh>
+#include <nvbench/device_manager.cuh>
 #include <nvbench/option_parser.cuh>
 #include <nvbench/printer_base.cuh>
 
@@ -51,7 +52,10 @@
   try                                                                                              \
   {                                                                                                \
     NVBENCH_MAIN_BODY(argc, argv);                                                                 \
-    NVBENCH_CUDA_CALL(hipDeviceReset());                                                          \
+    if (nvbench::device_manager::get().get_number_of_devices() > 0)                                \
+    {                                                                                              \
+      NVBENCH_CUDA_CALL(hipDeviceReset());                                                         \
+    }                                                                                              \
     return 0;                                                                                      \
   }                                                                                                \
   catch (std::exception & e)                                                                       \
@@ -78,6 +82,14 @@
   {                                                                                                \
     NVBENCH_INITIALIZE_DRIVER_API;                                                                 \
     NVBENCH_MAIN_PARSE(argc, argv);                                                                \
+    /* `--isolate` workers serve their parent process, then exit: */                               \
+    if (const auto &worker = parser.get_isolate_worker(); worker.has_value())                      \
+    {                                                                                              \
+      auto &bench = *parser.get_benchmarks()[worker->first];                                       \
+      bench.run_isolated_worker(worker->second);                                                   \
+      break;                                                                                       \
+    }                                                                                              \
+                                                                                                   \
     auto &printer = parser.get_printer();                                                          \
                                                                                                    \
     printer.print_device_info();                                                                   \
@@ -39,6 +39,7 @@
 
 #include <nvbench/types.cuh>
 
+#include <cstdint>
 #include <string>
 #include <variant>
 #include <vector>
@@ -49,6 +50,11 @@ namespace nvbench
 /**
  * Maintains a map of key / value pairs where the keys are names and the
  * values may be int64s, float64s, or strings.
+ *
+ * Values are kept in insertion order. Small sets are searched linearly; once
+ * there are more than a handful of values, lookups go through a hash index
+ * and take constant time. If a name is set more than once, lookups find the
+ * earliest value.
  */
 struct named_values
 {
@@ -89,11 +95,28 @@ private:
   {
     std::string name;
     value_type value;
+    std::size_t hash; // Only set while m_index is in use
   };
   // Use a vector to preserve order:
   using storage_type = std::vector<named_value>;
 
+  // Below this size, a linear scan beats hashing the name:
+  static constexpr std::size_t linear_search_limit = 8;
+  static constexpr std::size_t npos                = static_cast<std::size_t>(-1);
+
+  [[nodiscard]] static std::size_t hash_name(const std::string &name);
+  // Position of the first value with the given name in m_storage, or npos:
+  [[nodiscard]] std::size_t find(const std::string &name) const;
+  void push_back(std::string name, value_type value);
+  void index_insert(std::size_t pos);
+  void rebuild_index();
+
   storage_type m_storage;
+
+  // Open-addressing (linear probing) index into m_storage, keyed by the first
+  // value of each name. Slots hold a position + 1, or 0 if empty. Empty until
+  // m_storage grows past linear_search_limit.
+  std::vector<std::uint32_t> m_index;
 };
 
 } // namespace nvbench
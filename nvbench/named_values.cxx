@@ -43,19 +43,123 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <stdexcept>
+#include <string_view>
 #include <type_traits>
 
 namespace nvbench
 {
 
+std::size_t named_values::hash_name(const std::string &name)
+{
+  return std::hash<std::string_view>{}(name);
+}
+
+std::size_t named_values::find(const std::string &name) const
+{
+  if (m_index.empty())
+  {
+    const auto iter = std::find_if(m_storage.cbegin(), m_storage.cend(), [&name](const auto &val) {
+      return val.name == name;
+    });
+    return iter == m_storage.cend() ? npos : static_cast<std::size_t>(iter - m_storage.cbegin());
+  }
+
+  const std::size_t hash = hash_name(name);
+  const std::size_t mask = m_index.size() - 1;
+  for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask)
+  {
+    const std::uint32_t entry = m_index[slot];
+    if (entry == 0)
+    {
+      return npos;
+    }
+    const auto &val = m_storage[entry - 1];
+    if (val.hash == hash && val.name == name)
+    {
+      return entry - 1;
+    }
+  }
+}
+
+void named_values::index_insert(std::size_t pos)
+{
+  const std::size_t mask = m_index.size() - 1;
+  std::size_t slot       = m_storage[pos].hash & mask;
+  while (m_index[slot] != 0)
+  {
+    slot = (slot + 1) & mask;
+  }
+  m_index[slot] = static_cast<std::uint32_t>(pos + 1);
+}
+
+void named_values::rebuild_index()
+{
+  m_index.clear();
+  if (m_storage.size() <= linear_search_limit)
+  {
+    return;
+  }
+
+  // Keep the load factor between 1/4 and 1/2:
+  std::size_t capacity = 16;
+  while (capacity < 4 * m_storage.size())
+  {
+    capacity *= 2;
+  }
+  m_index.resize(capacity, 0);
+
+  for (std::size_t pos = 0; pos < m_storage.size(); ++pos)
+  {
+    auto &val = m_storage[pos];
+    val.hash  = hash_name(val.name);
+    // Only the first value of each name is indexed. find() probes the
+    // partially built table here:
+    if (this->find(val.name) == npos)
+    {
+      this->index_insert(pos);
+    }
+  }
+}
+
+void named_values::push_back(std::string name, value_type value)
+{
+  if (m_index.empty())
+  {
+    m_storage.push_back({std::move(name), std::move(value), 0});
+    if (m_storage.size() > linear_search_limit)
+    {
+      this->rebuild_index();
+    }
+    return;
+  }
+
+  const bool is_new_name = this->find(name) == npos;
+  const auto hash        = hash_name(name);
+  m_storage.push_back({std::move(name), std::move(value), hash});
+  if (2 * m_storage.size() > m_index.size())
+  {
+    this->rebuild_index();
+  }
+  else if (is_new_name)
+  {
+    this->index_insert(m_storage.size() - 1);
+  }
+}
+
 void named_values::append(const named_values &other)
 {
   m_storage.insert(m_storage.end(), other.m_storage.cbegin(), other.m_storage.cend());
+  this->rebuild_index();
 }
 
-void named_values::clear() { m_storage.clear(); }
+void named_values::clear()
+{
+  m_storage.clear();
+  m_index.clear();
+}
 
 std::size_t named_values::get_size() const { return m_storage.size(); }
 
@@ -72,22 +176,17 @@ std::vector<std::string> named_values::get_names() const
 
 bool named_values::has_value(const std::string &name) const
 {
-  auto iter = std::find_if(m_storage.cbegin(), m_storage.cend(), [&name](const auto &val) {
-    return val.name == name;
-  });
-  return iter != m_storage.cend();
+  return this->find(name) != npos;
 }
 
 const named_values::value_type &named_values::get_value(const std::string &name) const
 {
-  auto iter = std::find_if(m_storage.cbegin(), m_storage.cend(), [&name](const auto &val) {
-    return val.name == name;
-  });
-  if (iter == m_storage.cend())
+  const auto pos = this->find(name);
+  if (pos == npos)
   {
     NVBENCH_THROW(std::runtime_error, "No value with name '{}'.", name);
   }
-  return iter->value;
+  return m_storage[pos].value;
 }
 
 named_values::type named_values::get_type(const std::string &name) const
@@ -144,32 +243,36 @@ catch (std::exception &err)
 
 void named_values::set_int64(std::string name, nvbench::int64_t value)
 {
-  m_storage.push_back({std::move(name), value_type{value}});
+  this->push_back(std::move(name), value_type{value});
 }
 
 void named_values::set_float64(std::string name, nvbench::float64_t value)
 {
-  m_storage.push_back({std::move(name), value_type{value}});
+  this->push_back(std::move(name), value_type{value});
 }
 
 void named_values::set_string(std::string name, std::string value)
 {
-  m_storage.push_back({std::move(name), value_type{std::move(value)}});
+  this->push_back(std::move(name), value_type{std::move(value)});
 }
 
 void named_values::set_value(std::string name, named_values::value_type value)
 {
-  m_storage.push_back({std::move(name), std::move(value)});
+  this->push_back(std::move(name), std::move(value));
 }
 
 void named_values::remove_value(const std::string &name)
 {
-  auto iter = std::find_if(m_storage.begin(), m_storage.end(), [&name](const auto &val) {
-    return val.name == name;
-  });
-  if (iter != m_storage.end())
+  const auto pos = this->find(name);
+  if (pos != npos)
   {
-    m_storage.erase(iter);
+    m_storage.erase(m_storage.begin() + static_cast<std::ptrdiff_t>(pos));
+    // Positions after `pos` have shifted, and a later value with the same
+    // name may now be visible:
+    if (!m_index.empty())
+    {
+      this->rebuild_index();
+    }
   }
 }
 
@@ -39,10 +39,17 @@
 
 #include <nvbench/device_info.cuh>
 #include <nvbench/printer_multiplex.cuh>
+#include <nvbench/sharding.cuh>
+#include <nvbench/types.cuh>
+
+#include <nvbench/detail/sample_file.cuh>
 
 #include <iosfwd>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace nvbench
@@ -51,6 +58,7 @@ namespace nvbench
 struct benchmark_base;
 struct float64_axis;
 struct int64_axis;
+struct json_printer;
 struct printer_base;
 struct string_axis;
 struct type_axis;
@@ -85,6 +93,19 @@ struct option_parser
   // printer_base has no useful const API, so no const overload.
   [[nodiscard]] nvbench::printer_base &get_printer();
 
+  /*!
+   * Set if this process was started as an `--isolate` worker: the index of
+   * the benchmark in `get_benchmarks()` whose states it should serve, and the
+   * file descriptor to serve them on. See `nvbench::detail::worker_process`.
+   *
+   * Workers have no printers, and should only call
+   * `benchmark_base::run_isolated_worker` before exiting.
+   */
+  [[nodiscard]] const std::optional<std::pair<std::size_t, int>> &get_isolate_worker() const
+  {
+    return m_isolate_worker;
+  }
+
 private:
   void parse_impl();
 
@@ -93,7 +114,10 @@ private:
 
   void add_markdown_printer(const std::string &spec);
   void add_csv_printer(const std::string &spec);
-  void add_json_printer(const std::string &spec, bool enable_binary);
+  void add_json_printer(const std::string &spec,
+                        bool enable_binary,
+                        nvbench::detail::sample_file_type binary_type =
+                          nvbench::detail::sample_file_type::float32);
 
   std::ostream &printer_spec_to_ostream(const std::string &spec);
 
@@ -104,9 +128,15 @@ private:
 
   void set_persistence_mode(const std::string &state);
   void lock_gpu_clocks(const std::string &rate);
+  void set_time_budget(const std::string &seconds);
 
   void enable_run_once();
   void disable_blocking_kernel();
+  void enable_streaming_percentiles();
+  void enable_subtract_timer_overhead();
+  void enable_parallel_devices();
+  void enable_isolate();
+  void set_isolate_worker(const std::string &index, const std::string &fd);
 
   void add_benchmark(const std::string &name);
   void replay_global_args();
@@ -114,6 +144,7 @@ private:
   void update_devices(const std::string &devices);
 
   void update_axis(const std::string &spec);
+  void zip_axes(const std::string &spec);
   static void update_int64_axis(int64_axis &axis,
                                 std::string_view value_spec,
                                 std::string_view flag_spec);
@@ -129,6 +160,7 @@ private:
 
   void update_int64_prop(const std::string &prop_arg, const std::string &prop_val);
   void update_float64_prop(const std::string &prop_arg, const std::string &prop_val);
+  void update_string_prop(const std::string &prop_arg, const std::string &prop_val);
 
   void update_used_device_state() const;
 
@@ -145,6 +177,26 @@ private:
 
   benchmark_vector m_benchmarks;
 
+  // Shard costs read by --shard-costs, by filename. Shared by all benchmarks
+  // so each file is only parsed once.
+  std::map<std::string, std::shared_ptr<const nvbench::shard_cost_map>> m_shard_costs;
+
+  // Walltime budget for the whole run, from --time-budget:
+  std::optional<nvbench::float64_t> m_time_budget;
+
+  // Journal of completed states from --checkpoint or --resume, which also
+  // restores the states it already records:
+  std::string m_checkpoint_filename;
+  bool m_resume{false};
+
+  // Printers added by --json*, which keep earlier sample files on --resume:
+  std::vector<nvbench::json_printer *> m_json_printers;
+
+  // Set in `--isolate` worker processes, see `nvbench::detail::worker_process`.
+  // The index of the benchmark to serve and the connection to serve it on:
+  bool m_is_isolate_worker{false};
+  std::optional<std::pair<std::size_t, int>> m_isolate_worker;
+
   // Manages lifetimes of any ofstreams opened for m_printer.
   std::vector<std::unique_ptr<std::ofstream>> m_ofstream_storage;
 
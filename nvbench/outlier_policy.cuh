@@ -0,0 +1,82 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/detail/throw.cuh>
+
+#include <stdexcept>
+#include <string_view>
+
+namespace nvbench
+{
+
+/**
+ * Selects how cold measurements identify outlier samples (e.g. launches
+ * delayed by interrupts or clock throttling).
+ *
+ * - `none`: All samples are used.
+ * - `mad`: Samples more than `threshold` scaled median absolute deviations
+ *   from the median are rejected.
+ * - `iqr`: Samples more than `threshold` interquartile ranges below the first
+ *   quartile or above the third quartile are rejected.
+ *
+ * Rejected samples are excluded from all reported statistics and from the
+ * convergence checks.
+ */
+enum class outlier_policy
+{
+  none,
+  mad,
+  iqr
+};
+
+inline std::string_view outlier_policy_to_string(outlier_policy policy)
+{
+  switch (policy)
+  {
+    case outlier_policy::none:
+      return "none";
+    case outlier_policy::mad:
+      return "mad";
+    case outlier_policy::iqr:
+      return "iqr";
+  }
+  throw std::runtime_error{"nvbench::outlier_policy_to_string Invalid outlier_policy."};
+}
+
+inline outlier_policy outlier_policy_from_string(std::string_view name)
+{
+  if (name == "none")
+  {
+    return outlier_policy::none;
+  }
+  else if (name == "mad")
+  {
+    return outlier_policy::mad;
+  }
+  else if (name == "iqr")
+  {
+    return outlier_policy::iqr;
+  }
+  NVBENCH_THROW(std::runtime_error,
+                "Invalid outlier policy `{}`. Expected `none`, `mad` or `iqr`.",
+                name);
+}
+
+} // namespace nvbench
@@ -41,6 +41,8 @@
 
 #include <nvbench/detail/state_generator.cuh>
 
+#include <functional>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
@@ -54,16 +56,41 @@ struct runner_base
       : m_benchmark{bench}
   {}
 
+  /// Materialize all states in `benchmark_base::get_states()` before
+  /// running. If this isn't called, `run()` generates each state lazily just
+  /// before it is executed.
   void generate_states();
 
   void handle_sampling_exception(const std::exception &e, nvbench::state &exec_state) const;
 
+  /// Call `run_device(i)` for each device index on a separate thread. The
+  /// benchmark's printer is synchronized while they run. Rethrows the first
+  /// exception that escapes a worker once all of them have finished.
+  void run_devices_in_parallel(const std::function<void(std::size_t)> &run_device);
+
+  /// If the benchmark's checkpoint journal recorded `exec_state` in an earlier
+  /// run, restore its results and report it as completed. Returns false if
+  /// the state must be run.
+  bool restore_state(state &exec_state) const;
+
   void run_state_prologue(state &exec_state) const;
   void run_state_epilogue(state &exec_state) const;
 
+  /// Run the generated states in a worker process (`--isolate`). If the worker
+  /// crashes or hangs, the state it was running is skipped and a new worker
+  /// is started for the next one.
+  void run_isolated();
+
+  /// Worker side of `run_isolated`; see `nvbench::detail::serve_worker_states`.
+  void serve_isolated_states(int fd, const std::function<void(std::size_t)> &execute_state);
+
   void print_skip_notification(nvbench::state &exec_state) const;
 
   nvbench::benchmark_base &m_benchmark;
+  bool m_states_generated{false};
+  // The generated states of each device and type config; see
+  // `state_generator::create`:
+  std::vector<nvbench::detail::state_generator::state_span> m_state_spans;
 };
 
 template <typename BenchmarkType>
@@ -80,21 +107,78 @@ struct runner : public runner_base
 
   void run()
   {
+    if (m_benchmark.m_isolate)
+    {
+      // Workers find states by their index, so generate them all first:
+      if (!m_states_generated)
+      {
+        this->generate_states();
+      }
+      this->run_isolated();
+      return;
+    }
+
+    // Unless they were requested up front, states are constructed one at a
+    // time and appended to the benchmark's states as they run:
+    std::optional<nvbench::detail::state_generator> generator;
+    if (!m_states_generated)
+    {
+      m_benchmark.m_states.clear();
+      generator.emplace(m_benchmark);
+    }
+
+    auto &states = m_benchmark.m_states;
     if (m_benchmark.m_devices.empty())
     {
-      this->run_device(std::nullopt);
+      this->run_device(0, std::nullopt, generator, states);
+    }
+    else if (m_benchmark.m_parallel_devices && m_benchmark.m_devices.size() > 1)
+    {
+      // Each worker runs its device's states in place, or generates them into
+      // its own vector. These are appended in device order afterwards, so
+      // results are ordered as in a sequential run:
+      std::vector<std::vector<nvbench::state>> device_states(generator ? m_benchmark.m_devices.size()
+                                                                       : 0);
+      this->run_devices_in_parallel([this, &generator, &states, &device_states](std::size_t i) {
+        auto device_generator = generator;
+        this->run_device(i,
+                         m_benchmark.m_devices[i],
+                         device_generator,
+                         device_generator ? device_states[i] : states);
+      });
+      for (auto &cur_states : device_states)
+      {
+        for (auto &cur_state : cur_states)
+        {
+          states.push_back(std::move(cur_state));
+        }
+      }
     }
     else
     {
-      for (const auto &device : m_benchmark.m_devices)
+      for (std::size_t i = 0; i < m_benchmark.m_devices.size(); ++i)
       {
-        this->run_device(device);
+        this->run_device(i, m_benchmark.m_devices[i], generator, states);
       }
     }
   }
 
+  /// Worker side of `run()` with `--isolate`: generates the states, then runs
+  /// the ones requested over `fd` until the connection is closed.
+  void run_isolated_worker(int fd)
+  {
+    this->generate_states();
+    this->serve_isolated_states(fd,
+                                [this](std::size_t index) { this->execute_state_at(index); });
+  }
+
 private:
-  void run_device(const std::optional<nvbench::device_info> &device)
+  // Generated states are appended to `states`. Otherwise, `states` holds the
+  // generated states and those in `device_index`'s spans are run.
+  void run_device(std::size_t device_index,
+                  const std::optional<nvbench::device_info> &device,
+                  std::optional<nvbench::detail::state_generator> &generator,
+                  std::vector<nvbench::state> &states)
   {
     if (device)
     {
@@ -103,38 +187,87 @@ private:
 
     // Iterate through type_configs:
     std::size_t type_config_index = 0;
-    nvbench::tl::foreach<type_configs>(
-      [&self = *this, &states = m_benchmark.m_states, &type_config_index, &device](
-        auto type_config_wrapper) {
-        // Get current type_config:
-        using type_config = typename decltype(type_config_wrapper)::type;
+    nvbench::tl::foreach<type_configs>([&self = *this,
+                                        &states,
+                                        &type_config_index,
+                                        &device,
+                                        &generator,
+                                        first_span = device_index * num_type_configs](
+                                         auto type_config_wrapper) {
+      // Get current type_config:
+      using type_config = typename decltype(type_config_wrapper)::type;
 
-        // Find states with the current device / type_config
-        for (nvbench::state &cur_state : states)
+      if (generator)
+      {
+        generator->init(device, type_config_index);
+        while (auto next_state = generator->next())
+        {
+          self.template run_state<type_config>(states.emplace_back(std::move(*next_state)));
+        }
+      }
+      else
+      {
+        const auto &span = self.m_state_spans[first_span + type_config_index];
+        for (std::size_t i = span.begin; i < span.end; ++i)
         {
-          if (cur_state.get_device() == device &&
-              cur_state.get_type_config_index() == type_config_index)
-          {
-            self.run_state_prologue(cur_state);
-            try
-            {
-              kernel_generator{}(cur_state, type_config{});
-              if (cur_state.is_skipped())
-              {
-                self.print_skip_notification(cur_state);
-              }
-            }
-            catch (std::exception &e)
-            {
-              self.handle_sampling_exception(e, cur_state);
-            }
-            self.run_state_epilogue(cur_state);
-          }
+          self.template run_state<type_config>(states[i]);
         }
+      }
+
+      ++type_config_index;
+    });
+  }
+
+  template <typename TypeConfig>
+  void run_state(nvbench::state &cur_state)
+  {
+    if (this->restore_state(cur_state))
+    {
+      return;
+    }
+
+    this->run_state_prologue(cur_state);
+    this->execute_state<TypeConfig>(cur_state);
+    this->run_state_epilogue(cur_state);
+  }
+
+  // Runs the generated state at `index` for an `--isolate` worker. The
+  // requesting process handles the prologue and epilogue.
+  void execute_state_at(std::size_t index)
+  {
+    auto &cur_state = m_benchmark.m_states[index];
+    if (const auto &device = cur_state.get_device(); device)
+    {
+      device->set_active();
+    }
 
-        ++type_config_index;
+    std::size_t type_config_index = 0;
+    nvbench::tl::foreach<type_configs>(
+      [&self = *this, &cur_state, &type_config_index](auto type_config_wrapper) {
+        using type_config = typename decltype(type_config_wrapper)::type;
+        if (type_config_index++ == cur_state.get_type_config_index())
+        {
+          self.template execute_state<type_config>(cur_state);
+        }
       });
   }
+
+  template <typename TypeConfig>
+  void execute_state(nvbench::state &cur_state)
+  {
+    try
+    {
+      kernel_generator{}(cur_state, TypeConfig{});
+      if (cur_state.is_skipped())
+      {
+        this->print_skip_notification(cur_state);
+      }
+    }
+    catch (std::exception &e)
+    {
+      this->handle_sampling_exception(e, cur_state);
+    }
+  }
 };
 
 } // namespace nvbench
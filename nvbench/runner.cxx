@@ -41,17 +41,30 @@
 #include <nvbench/printer_base.cuh>
 #include <nvbench/state.cuh>
 
+#include <nvbench/detail/budget_scheduler.cuh>
+#include <nvbench/detail/checkpoint_journal.cuh>
+#include <nvbench/detail/synchronized_printer.cuh>
+#include <nvbench/detail/throw.cuh>
+#include <nvbench/detail/worker_process.cuh>
+
 #include <fmt/format.h>
 
 #include <cstdio>
+#include <exception>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace nvbench
 {
 
 void runner_base::generate_states()
 {
-  m_benchmark.m_states = nvbench::detail::state_generator::create(m_benchmark);
+  m_benchmark.m_states = nvbench::detail::state_generator::create(m_benchmark, m_state_spans);
+  m_states_generated   = true;
 }
 
 void runner_base::handle_sampling_exception(const std::exception &e, state &exec_state) const
@@ -77,8 +90,89 @@ void runner_base::handle_sampling_exception(const std::exception &e, state &exec
   }
 }
 
+void runner_base::run_devices_in_parallel(const std::function<void(std::size_t)> &run_device)
+{
+  // Route the workers' printer calls through a lock for the duration:
+  const auto printer_opt_ref = m_benchmark.get_printer();
+  std::optional<nvbench::detail::synchronized_printer> sync_printer;
+  if (printer_opt_ref.has_value())
+  {
+    sync_printer.emplace(printer_opt_ref.value().get());
+    m_benchmark.set_printer(*sync_printer);
+  }
+
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(m_benchmark.m_devices.size());
+    for (std::size_t i = 0; i < m_benchmark.m_devices.size(); ++i)
+    {
+      workers.emplace_back([&run_device, &error_mutex, &error, i]() {
+        try
+        {
+          run_device(i);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock{error_mutex};
+          if (!error)
+          {
+            error = std::current_exception();
+          }
+        }
+      });
+    }
+    for (auto &worker : workers)
+    {
+      worker.join();
+    }
+  }
+
+  if (printer_opt_ref.has_value())
+  {
+    m_benchmark.set_printer(printer_opt_ref.value().get());
+  }
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+bool runner_base::restore_state(nvbench::state &exec_state) const
+{
+  const auto &journal = m_benchmark.get_checkpoint_journal();
+  if (!journal || !journal->restore(exec_state))
+  {
+    return false;
+  }
+
+  // The state no longer needs any of the budget:
+  const auto &scheduler = m_benchmark.get_budget_scheduler();
+  const bool last_state = scheduler && scheduler->remove_state();
+
+  if (auto printer_opt_ref = exec_state.get_benchmark().get_printer(); printer_opt_ref.has_value())
+  {
+    auto &printer = printer_opt_ref.value().get();
+    printer.log_run_state(exec_state);
+    printer.log(nvbench::log_level::info,
+                fmt::format("Restored from checkpoint journal `{}`.", journal->get_filename()));
+    printer.add_completed_state();
+    if (last_state)
+    {
+      printer.log(nvbench::log_level::info, scheduler->get_report());
+    }
+  }
+  return true;
+}
+
 void runner_base::run_state_prologue(nvbench::state &exec_state) const
 {
+  if (const auto &scheduler = m_benchmark.get_budget_scheduler(); scheduler)
+  {
+    scheduler->schedule(exec_state);
+  }
+
   // Log if a printer exists:
   if (auto printer_opt_ref = exec_state.get_benchmark().get_printer(); printer_opt_ref.has_value())
   {
@@ -87,13 +181,80 @@ void runner_base::run_state_prologue(nvbench::state &exec_state) const
   }
 }
 
+void runner_base::run_isolated()
+{
+  if (m_benchmark.get_isolate_args().empty())
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Benchmark `{}` is isolated, but has no worker command line.",
+                  m_benchmark.get_name());
+  }
+
+  auto &states = m_benchmark.m_states;
+  std::optional<nvbench::detail::worker_process> worker;
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    auto &cur_state = states[i];
+    if (this->restore_state(cur_state))
+    {
+      continue;
+    }
+
+    this->run_state_prologue(cur_state);
+    if (!worker)
+    {
+      worker.emplace(m_benchmark.get_isolate_args());
+    }
+    if (auto failure = worker->run_state(i, cur_state); failure)
+    {
+      // The worker is gone; the next state starts a new one:
+      worker.reset();
+      if (auto printer_opt_ref = m_benchmark.get_printer(); printer_opt_ref.has_value())
+      {
+        auto &printer = printer_opt_ref.value().get();
+        printer.log(nvbench::log_level::fail, *failure);
+      }
+      cur_state.skip(std::move(*failure));
+    }
+    this->run_state_epilogue(cur_state);
+  }
+}
+
+void runner_base::serve_isolated_states(int fd,
+                                        const std::function<void(std::size_t)> &execute_state)
+{
+  auto &states = m_benchmark.m_states;
+  nvbench::detail::serve_worker_states(fd, m_benchmark, states, [&](std::size_t index) {
+    execute_state(index);
+    // Only the results are sent back; return the stream to the pool:
+    states[index].release_cuda_stream();
+  });
+}
+
 void runner_base::run_state_epilogue(state &exec_state) const
 {
+  // Only the results are retained once a state has run; return its stream to
+  // the pool:
+  exec_state.release_cuda_stream();
+
+  const auto &scheduler = m_benchmark.get_budget_scheduler();
+  const bool last_state = scheduler && scheduler->complete(exec_state);
+
+  // Persist the results before reporting the state as completed:
+  if (const auto &journal = m_benchmark.get_checkpoint_journal(); journal)
+  {
+    journal->record(exec_state);
+  }
+
   // Notify the printer that the state has completed::
   if (auto printer_opt_ref = exec_state.get_benchmark().get_printer(); printer_opt_ref.has_value())
   {
     auto &printer = printer_opt_ref.value().get();
     printer.add_completed_state();
+    if (last_state)
+    {
+      printer.log(nvbench::log_level::info, scheduler->get_report());
+    }
   }
 }
 
@@ -0,0 +1,143 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace nvbench
+{
+
+/**
+ * Selects how a subset of a benchmark's configurations is chosen when only a
+ * representative sample of a large parameter space is needed. Points are
+ * drawn from the cartesian product of the (active) type configs and the
+ * non-type axes without enumerating it.
+ *
+ * - `none`: Every configuration is run.
+ * - `random`: Distinct configurations chosen uniformly at random.
+ * - `lhs`: Latin hypercube sampling; each axis' values are covered as evenly
+ *   as the sample size allows. Duplicate points are dropped.
+ * - `sobol`: A randomly shifted Sobol low-discrepancy sequence, supporting up
+ *   to 16 dimensions. Duplicate points are skipped.
+ */
+enum class sample_method
+{
+  none,
+  random,
+  lhs,
+  sobol
+};
+
+/**
+ * A sampling method and the number of configurations to select. If `count`
+ * is at least the size of the parameter space, every configuration is run.
+ */
+struct sample_spec
+{
+  sample_method method{sample_method::none};
+  nvbench::int64_t count{};
+
+  [[nodiscard]] bool is_enabled() const { return method != sample_method::none; }
+};
+
+inline std::string_view sample_method_to_string(sample_method method)
+{
+  switch (method)
+  {
+    case sample_method::none:
+      return "none";
+    case sample_method::random:
+      return "random";
+    case sample_method::lhs:
+      return "lhs";
+    case sample_method::sobol:
+      return "sobol";
+  }
+  throw std::runtime_error{"nvbench::sample_method_to_string Invalid sample_method."};
+}
+
+inline sample_method sample_method_from_string(std::string_view name)
+{
+  if (name == "none")
+  {
+    return sample_method::none;
+  }
+  else if (name == "random")
+  {
+    return sample_method::random;
+  }
+  else if (name == "lhs")
+  {
+    return sample_method::lhs;
+  }
+  else if (name == "sobol")
+  {
+    return sample_method::sobol;
+  }
+  NVBENCH_THROW(std::runtime_error,
+                "Invalid sample method `{}`. Expected `none`, `random`, `lhs` or `sobol`.",
+                name);
+}
+
+/// Parses `<method>:<count>`, e.g. `lhs:100`, or `none`.
+inline sample_spec sample_spec_from_string(std::string_view spec)
+{
+  const auto colon = spec.find(':');
+  sample_spec result{sample_method_from_string(spec.substr(0, colon)), 0};
+  if (!result.is_enabled())
+  {
+    return result;
+  }
+
+  if (colon == std::string_view::npos)
+  {
+    NVBENCH_THROW(std::runtime_error, "Missing sample count in `{}`. Expected `<method>:<N>`.", spec);
+  }
+  const auto count_str = spec.substr(colon + 1);
+  const auto [end, err] =
+    std::from_chars(count_str.data(), count_str.data() + count_str.size(), result.count);
+  if (err != std::errc{} || end != count_str.data() + count_str.size() || result.count <= 0)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Invalid sample count `{}` in `{}`. Expected a positive integer.",
+                  count_str,
+                  spec);
+  }
+  return result;
+}
+
+inline std::string sample_spec_to_string(const sample_spec &spec)
+{
+  if (!spec.is_enabled())
+  {
+    return "none";
+  }
+  return fmt::format("{}:{}", sample_method_to_string(spec.method), spec.count);
+}
+
+} // namespace nvbench
@@ -0,0 +1,71 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/named_values.cuh>
+#include <nvbench/types.cuh>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace nvbench
+{
+
+/**
+ * Selects the slice of a benchmark's configurations run by this process when
+ * the benchmark is split across `count` processes (`--shard index/count`).
+ *
+ * Each configuration is assigned to exactly one shard, so running every shard
+ * covers each configuration once. Assignments only depend on the benchmark
+ * name and the configuration's axis values (not on devices or the process),
+ * so they agree across machines.
+ */
+struct shard_spec
+{
+  nvbench::int64_t index{0};
+  nvbench::int64_t count{1};
+
+  [[nodiscard]] bool is_enabled() const { return count > 1; }
+};
+
+/// Parses `<index>/<count>`, e.g. `2/8`. `index` is zero-based.
+[[nodiscard]] shard_spec shard_spec_from_string(std::string_view spec);
+
+/// Estimated cost in seconds of each configuration, keyed by `hash_config`.
+using shard_cost_map = std::unordered_map<std::uint64_t, nvbench::float64_t>;
+
+/**
+ * Stable 64-bit hash of a configuration, used to assign it to a shard.
+ *
+ * Derived from the benchmark name and the axis names and values, formatted as
+ * they are in JSON output, so it can be recomputed from a prior JSON file.
+ */
+[[nodiscard]] std::uint64_t hash_config(std::string_view benchmark_name,
+                                        const nvbench::named_values &config);
+
+/**
+ * Reads per-configuration costs from a JSON file written by `--json`. The
+ * cost of a configuration is its total cold + batch (or `exec_tag::cpu`)
+ * walltime, summed over devices.
+ */
+[[nodiscard]] shard_cost_map read_shard_costs(const std::string &filename);
+
+} // namespace nvbench
@@ -0,0 +1,171 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/sharding.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <nlohmann/json.hpp>
+
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+
+namespace nvbench
+{
+
+namespace
+{
+
+// 64-bit FNV-1a; stable across platforms and standard library versions:
+struct fnv1a
+{
+  void update(std::string_view data)
+  {
+    for (const char c : data)
+    {
+      m_hash ^= static_cast<unsigned char>(c);
+      m_hash *= 0x100000001b3ull;
+    }
+  }
+
+  std::uint64_t m_hash{0xcbf29ce484222325ull};
+};
+
+// Matches the formatting of axis values in JSON output:
+std::string value_to_string(const nvbench::named_values &config, const std::string &name)
+{
+  switch (config.get_type(name))
+  {
+    case nvbench::named_values::type::int64:
+      return fmt::to_string(config.get_int64(name));
+    case nvbench::named_values::type::float64:
+      return fmt::to_string(config.get_float64(name));
+    case nvbench::named_values::type::string:
+      return config.get_string(name);
+  }
+  return {};
+}
+
+template <typename T>
+T parse_integer(std::string_view str, std::string_view spec)
+{
+  T value{};
+  const auto [end, err] = std::from_chars(str.data(), str.data() + str.size(), value);
+  if (err != std::errc{} || end != str.data() + str.size())
+  {
+    NVBENCH_THROW(std::runtime_error, "Invalid shard `{}`. Expected `<index>/<count>`.", spec);
+  }
+  return value;
+}
+
+} // namespace
+
+shard_spec shard_spec_from_string(std::string_view spec)
+{
+  const auto slash = spec.find('/');
+  if (slash == std::string_view::npos)
+  {
+    NVBENCH_THROW(std::runtime_error, "Invalid shard `{}`. Expected `<index>/<count>`.", spec);
+  }
+
+  shard_spec result;
+  result.index = parse_integer<nvbench::int64_t>(spec.substr(0, slash), spec);
+  result.count = parse_integer<nvbench::int64_t>(spec.substr(slash + 1), spec);
+  if (result.count < 1 || result.index < 0 || result.index >= result.count)
+  {
+    NVBENCH_THROW(std::runtime_error,
+                  "Invalid shard `{}`. Requires 0 <= index < count.",
+                  spec);
+  }
+  return result;
+}
+
+std::uint64_t hash_config(std::string_view benchmark_name, const nvbench::named_values &config)
+{
+  // Separators can't be confused with the contents of names and values:
+  fnv1a hash;
+  hash.update(benchmark_name);
+  hash.update("\x1f");
+  for (const auto &name : config.get_names())
+  {
+    hash.update(name);
+    hash.update("\x1d");
+    hash.update(value_to_string(config, name));
+    hash.update("\x1e");
+  }
+  return hash.m_hash;
+}
+
+shard_cost_map read_shard_costs(const std::string &filename)
+try
+{
+  std::ifstream file{filename};
+  if (!file)
+  {
+    NVBENCH_THROW(std::runtime_error, "{}", "Unable to open file.");
+  }
+  const auto root = nlohmann::json::parse(file);
+
+  shard_cost_map costs;
+  for (const auto &bench : root.at("benchmarks"))
+  {
+    const auto &bench_name = bench.at("name").get_ref<const std::string &>();
+    for (const auto &state : bench.at("states"))
+    {
+      nvbench::named_values config;
+      for (const auto &value : state.at("axis_values"))
+      {
+        // Values are stored as strings; reuse them verbatim so the hash
+        // matches the one computed from the live configuration:
+        config.set_string(value.at("name"), value.at("value"));
+      }
+
+      nvbench::float64_t cost{};
+      for (const auto &summ : state.at("summaries"))
+      {
+        const auto &tag = summ.at("tag").get_ref<const std::string &>();
+        if (tag != "nv/cold/walltime" && tag != "nv/batch/walltime" && tag != "nv/cpu/walltime")
+        {
+          continue;
+        }
+        for (const auto &data : summ.at("data"))
+        {
+          if (data.at("name") == "value")
+          {
+            cost += std::stod(data.at("value").get<std::string>());
+          }
+        }
+      }
+
+      costs[hash_config(bench_name, config)] += cost;
+    }
+  }
+  return costs;
+}
+catch (std::exception &e)
+{
+  NVBENCH_THROW(std::runtime_error,
+                "Error reading shard costs from '{}':\n{}",
+                filename,
+                e.what());
+}
+
+} // namespace nvbench
@@ -42,9 +42,12 @@
 #include <nvbench/device_info.cuh>
 #include <nvbench/exec_tag.cuh>
 #include <nvbench/named_values.cuh>
+#include <nvbench/outlier_policy.cuh>
 #include <nvbench/summary.cuh>
 #include <nvbench/types.cuh>
 
+#include <nvbench/detail/stream_pool.cuh>
+
 #include <functional>
 #include <optional>
 #include <string>
@@ -54,6 +57,7 @@ namespace nvbench
 {
 
 struct benchmark_base;
+struct runner_base;
 
 namespace detail
 {
@@ -83,8 +87,11 @@ struct state
   state &operator=(const state &) = delete;
   state &operator=(state &&)      = default;
 
-  [[nodiscard]] const nvbench::hip_stream &get_cuda_stream() const { return m_cuda_stream; }
-  void set_cuda_stream(nvbench::hip_stream &&stream) { m_cuda_stream = std::move(stream); }
+  /// The stream used for measurements. Unless one was provided with
+  /// `set_cuda_stream`, states with a device borrow a stream from a per-device
+  /// pool the first time this is called, e.g. by `exec`.
+  [[nodiscard]] const nvbench::hip_stream &get_cuda_stream() const;
+  void set_cuda_stream(nvbench::hip_stream &&stream);
 
   /// The CUDA device associated with with this benchmark state. May be
   /// nullopt for CPU-only benchmarks.
@@ -155,6 +162,20 @@ struct state
   void set_disable_blocking_kernel(bool v) { m_disable_blocking_kernel = v; }
   /// @}
 
+  /// If true, percentiles are estimated with constant-memory streaming
+  /// sketches instead of retaining every sample. Individual sample times are
+  /// not recorded in this mode. Intended for very long runs. @{
+  [[nodiscard]] bool get_streaming_percentiles() const { return m_streaming_percentiles; }
+  void set_streaming_percentiles(bool v) { m_streaming_percentiles = v; }
+  /// @}
+
+  /// If true, the timer overheads measured by
+  /// `device_manager::get_timer_calibration` are subtracted from each cold and
+  /// CPU-only sample. Intended for very short kernels. @{
+  [[nodiscard]] bool get_subtract_timer_overhead() const { return m_subtract_timer_overhead; }
+  void set_subtract_timer_overhead(bool v) { m_subtract_timer_overhead = v; }
+  /// @}
+
   /// Accumulate at least this many seconds of timing data per measurement. @{
   [[nodiscard]] nvbench::float64_t get_min_time() const { return m_min_time; }
   void set_min_time(nvbench::float64_t min_time) { m_min_time = min_time; }
@@ -167,6 +188,28 @@ struct state
   void set_max_noise(nvbench::float64_t max_noise) { m_max_noise = max_noise; }
   /// @}
 
+  /// If positive, cold measurements stop once the half-width of the 95%
+  /// bootstrap confidence interval of the mean GPU time drops below this
+  /// fraction of the mean. This replaces the `max_noise` criteria. @{
+  [[nodiscard]] nvbench::float64_t get_max_ci_half_width() const { return m_max_ci_half_width; }
+  void set_max_ci_half_width(nvbench::float64_t max_ci_half_width)
+  {
+    m_max_ci_half_width = max_ci_half_width;
+  }
+  /// @}
+
+  /// Policy used to reject outlier samples from cold measurements. See
+  /// `nvbench::outlier_policy`. @{
+  [[nodiscard]] nvbench::outlier_policy get_outlier_policy() const { return m_outlier_policy; }
+  void set_outlier_policy(nvbench::outlier_policy policy) { m_outlier_policy = policy; }
+  /// @}
+
+  /// Rejection threshold for the outlier policy, in units of the policy's
+  /// spread estimate (scaled MAD or IQR). @{
+  [[nodiscard]] nvbench::float64_t get_outlier_threshold() const { return m_outlier_threshold; }
+  void set_outlier_threshold(nvbench::float64_t threshold) { m_outlier_threshold = threshold; }
+  /// @}
+
   /// If a warmup run finishes in less than `skip_time`, the measurement will
   /// be skipped.
   /// Extremely fast kernels (< 5000 ns) often timeout before they can
@@ -226,6 +269,7 @@ struct state
   [[nodiscard]] bool is_dram_throughput_collected() const { return m_collect_dram_throughput; }
 
   summary &add_summary(std::string summary_tag);
+  summary &add_summary(const summary_schema &schema);
   summary &add_summary(summary s);
   [[nodiscard]] const summary &get_summary(std::string_view tag) const;
   [[nodiscard]] summary &get_summary(std::string_view tag);
@@ -251,6 +295,7 @@ struct state
   }
 
 private:
+  friend struct nvbench::runner_base;
   friend struct nvbench::detail::state_generator;
   friend struct nvbench::detail::state_tester;
 
@@ -261,7 +306,12 @@ private:
         std::optional<nvbench::device_info> device,
         std::size_t type_config_index);
 
-  nvbench::hip_stream m_cuda_stream;
+  /// Return a pooled stream once the state has run.
+  void release_cuda_stream();
+
+  // Lazily initialized by get_cuda_stream():
+  mutable std::optional<nvbench::hip_stream> m_cuda_stream;
+  mutable nvbench::detail::stream_lease m_stream_lease;
   std::reference_wrapper<const nvbench::benchmark_base> m_benchmark;
   nvbench::named_values m_axis_values;
   std::optional<nvbench::device_info> m_device;
@@ -269,10 +319,16 @@ private:
 
   bool m_run_once{false};
   bool m_disable_blocking_kernel{false};
+  bool m_streaming_percentiles{false};
+  bool m_subtract_timer_overhead{false};
 
   nvbench::int64_t m_min_samples;
   nvbench::float64_t m_min_time;
   nvbench::float64_t m_max_noise;
+  nvbench::float64_t m_max_ci_half_width;
+
+  nvbench::outlier_policy m_outlier_policy;
+  nvbench::float64_t m_outlier_threshold;
 
   nvbench::float64_t m_skip_time;
   nvbench::float64_t m_timeout;
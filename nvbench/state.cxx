@@ -48,6 +48,38 @@
 #include <stdexcept>
 #include <string>
 
+namespace
+{
+
+std::size_t find_summary(const std::vector<nvbench::summary> &summaries, std::string_view tag)
+{
+  // Check tags first. Tags are interned, so compare their ids:
+  if (const auto tag_id = nvbench::summary_registry::get().find_tag_id(std::string{tag}); tag_id)
+  {
+    const auto iter =
+      std::find_if(summaries.cbegin(), summaries.cend(), [id = *tag_id](const auto &s) {
+        return s.get_schema().tag_id == id;
+      });
+    if (iter != summaries.cend())
+    {
+      return static_cast<std::size_t>(iter - summaries.cbegin());
+    }
+  }
+
+  // Then names:
+  const auto iter = std::find_if(summaries.cbegin(), summaries.cend(), [&tag](const auto &s) {
+    return s.has_value("name") && s.get_string("name") == tag;
+  });
+  if (iter != summaries.cend())
+  {
+    return static_cast<std::size_t>(iter - summaries.cbegin());
+  }
+
+  NVBENCH_THROW(std::invalid_argument, "No summary tagged '{}'.", tag);
+}
+
+} // namespace
+
 namespace nvbench
 {
 
@@ -55,9 +87,14 @@ state::state(const benchmark_base &bench)
     : m_benchmark{bench}
     , m_run_once{bench.get_run_once()}
     , m_disable_blocking_kernel{bench.get_disable_blocking_kernel()}
+    , m_streaming_percentiles{bench.get_streaming_percentiles()}
+    , m_subtract_timer_overhead{bench.get_subtract_timer_overhead()}
     , m_min_samples{bench.get_min_samples()}
     , m_min_time{bench.get_min_time()}
     , m_max_noise{bench.get_max_noise()}
+    , m_max_ci_half_width{bench.get_max_ci_half_width()}
+    , m_outlier_policy{bench.get_outlier_policy()}
+    , m_outlier_threshold{bench.get_outlier_threshold()}
     , m_skip_time{bench.get_skip_time()}
     , m_timeout{bench.get_timeout()}
 {}
@@ -72,13 +109,48 @@ state::state(const benchmark_base &bench,
     , m_type_config_index{type_config_index}
     , m_run_once{bench.get_run_once()}
     , m_disable_blocking_kernel{bench.get_disable_blocking_kernel()}
+    , m_streaming_percentiles{bench.get_streaming_percentiles()}
+    , m_subtract_timer_overhead{bench.get_subtract_timer_overhead()}
     , m_min_samples{bench.get_min_samples()}
     , m_min_time{bench.get_min_time()}
     , m_max_noise{bench.get_max_noise()}
+    , m_max_ci_half_width{bench.get_max_ci_half_width()}
+    , m_outlier_policy{bench.get_outlier_policy()}
+    , m_outlier_threshold{bench.get_outlier_threshold()}
     , m_skip_time{bench.get_skip_time()}
     , m_timeout{bench.get_timeout()}
 {}
 
+const nvbench::hip_stream &state::get_cuda_stream() const
+{
+  if (!m_cuda_stream)
+  {
+    if (m_device)
+    {
+      m_stream_lease = nvbench::detail::stream_pool::get().acquire(m_device->get_id());
+      m_cuda_stream  = nvbench::make_cuda_stream_view(m_stream_lease.get_stream());
+    }
+    else
+    { // Device-less states (e.g. `exec_tag::cpu` benchmarks) must not touch
+      // the runtime, so they use a non-owning view of the null stream:
+      m_cuda_stream = nvbench::make_cuda_stream_view(nullptr);
+    }
+  }
+  return *m_cuda_stream;
+}
+
+void state::set_cuda_stream(nvbench::hip_stream &&stream)
+{
+  m_cuda_stream = std::move(stream);
+  m_stream_lease.reset();
+}
+
+void state::release_cuda_stream()
+{
+  m_cuda_stream.reset();
+  m_stream_lease.reset();
+}
+
 nvbench::int64_t state::get_int64(const std::string &axis_name) const
 {
   return m_axis_values.get_int64(axis_name);
@@ -132,6 +204,11 @@ summary &state::add_summary(std::string summary_tag)
   return m_summaries.emplace_back(std::move(summary_tag));
 }
 
+summary &state::add_summary(const summary_schema &schema)
+{
+  return m_summaries.emplace_back(schema);
+}
+
 summary &state::add_summary(summary s)
 {
   m_summaries.push_back(std::move(s));
@@ -140,48 +217,12 @@ summary &state::add_summary(summary s)
 
 const summary &state::get_summary(std::string_view tag) const
 {
-  // Check tags first
-  auto iter = std::find_if(m_summaries.cbegin(), m_summaries.cend(), [&tag](const auto &s) {
-    return s.get_tag() == tag;
-  });
-  if (iter != m_summaries.cend())
-  {
-    return *iter;
-  }
-
-  // Then names:
-  iter = std::find_if(m_summaries.cbegin(), m_summaries.cend(), [&tag](const auto &s) {
-    return s.get_string("name") == tag;
-  });
-  if (iter != m_summaries.cend())
-  {
-    return *iter;
-  }
-
-  NVBENCH_THROW(std::invalid_argument, "No summary tagged '{}'.", tag);
+  return m_summaries[find_summary(m_summaries, tag)];
 }
 
 summary &state::get_summary(std::string_view tag)
 {
-  // Check tags first
-  auto iter = std::find_if(m_summaries.begin(), m_summaries.end(), [&tag](const auto &s) {
-    return s.get_tag() == tag;
-  });
-  if (iter != m_summaries.end())
-  {
-    return *iter;
-  }
-
-  // Then names:
-  iter = std::find_if(m_summaries.begin(), m_summaries.end(), [&tag](const auto &s) {
-    return s.get_string("name") == tag;
-  });
-  if (iter != m_summaries.end())
-  {
-    return *iter;
-  }
-
-  NVBENCH_THROW(std::invalid_argument, "No summary tagged '{}'.", tag);
+  return m_summaries[find_summary(m_summaries, tag)];
 }
 
 const std::vector<summary> &state::get_summaries() const { return m_summaries; }
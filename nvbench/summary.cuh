@@ -38,9 +38,13 @@
 #pragma once
 
 #include <nvbench/named_values.cuh>
+#include <nvbench/summary_registry.cuh>
+#include <nvbench/types.cuh>
 
+#include <memory>
+#include <optional>
 #include <string>
-#include <utility>
+#include <vector>
 
 namespace nvbench
 {
@@ -90,6 +94,10 @@ namespace nvbench
  *   - "size" is an int64_t containing the number of float32_t values stored in
  *     the binary file.
  *
+ * The tag and the "name", "hint", "description" and "hide" metadata are
+ * interned in nvbench::summary_registry and shared by every summary with the
+ * same values, so a summary only stores a pointer to its schema, its "value"
+ * and any other keys. Setting "value" or a metadata key again replaces it.
  *
  * Example: Adding a new summary to an nvbench::state object:
  *
@@ -102,12 +110,19 @@ namespace nvbench
  *                  timers.");
  * summ.set_float64("value", avg_batch_gpu_time);
  * ```
+ *
+ * Summaries that are added to every state should intern their schema once
+ * instead, see nvbench::summary_registry.
  */
-struct summary : public nvbench::named_values
+struct summary
 {
-  summary() = default;
-  explicit summary(std::string tag)
-      : m_tag(std::move(tag))
+  using value_type = nvbench::named_values::value_type;
+  using type       = nvbench::named_values::type;
+
+  summary();
+  explicit summary(std::string tag);
+  explicit summary(const summary_schema &schema)
+      : m_schema(&schema)
   {}
 
   // move-only
@@ -116,11 +131,39 @@ struct summary : public nvbench::named_values
   summary &operator=(const summary &) = delete;
   summary &operator=(summary &&)      = default;
 
-  void set_tag(std::string tag) { m_tag = std::move(tag); }
-  [[nodiscard]] const std::string &get_tag() const { return m_tag; }
+  void set_tag(std::string tag);
+  [[nodiscard]] const std::string &get_tag() const { return m_schema->tag; }
+
+  [[nodiscard]] const summary_schema &get_schema() const { return *m_schema; }
+
+  /// Metadata names, then "value" (if set), then other keys in insertion order.
+  [[nodiscard]] std::vector<std::string> get_names() const;
+  /// As get_names, without the metadata names.
+  [[nodiscard]] std::vector<std::string> get_data_names() const;
+  [[nodiscard]] std::size_t get_size() const;
+
+  void set_value(std::string name, value_type value);
+
+  void set_int64(std::string name, nvbench::int64_t value);
+  void set_float64(std::string name, nvbench::float64_t value);
+  void set_string(std::string name, std::string value);
+
+  [[nodiscard]] nvbench::int64_t get_int64(const std::string &name) const;
+  [[nodiscard]] nvbench::float64_t get_float64(const std::string &name) const;
+  [[nodiscard]] const std::string &get_string(const std::string &name) const;
+
+  [[nodiscard]] type get_type(const std::string &name) const;
+  [[nodiscard]] bool has_value(const std::string &name) const;
+  [[nodiscard]] const value_type &get_value(const std::string &name) const;
+
+  void remove_value(const std::string &name);
 
 private:
-  std::string m_tag;
+  const summary_schema *m_schema;
+  std::optional<value_type> m_value;
+  // Keys other than "value" and the metadata. Rarely used, so only allocated
+  // when needed:
+  std::unique_ptr<nvbench::named_values> m_data;
 };
 
 } // namespace nvbench
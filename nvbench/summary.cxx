@@ -0,0 +1,224 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/summary.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace nvbench
+{
+
+summary::summary()
+    : m_schema(&summary_registry::get().intern(std::string{}))
+{}
+
+summary::summary(std::string tag)
+    : m_schema(&summary_registry::get().intern(std::move(tag)))
+{}
+
+void summary::set_tag(std::string tag)
+{
+  // Keep the metadata:
+  auto &registry       = summary_registry::get();
+  const auto *schema   = &registry.intern(std::move(tag));
+  const auto &metadata = m_schema->metadata;
+  for (const auto &name : metadata.get_names())
+  {
+    schema = &registry.with_metadata(*schema, name, metadata.get_value(name));
+  }
+  m_schema = schema;
+}
+
+std::vector<std::string> summary::get_names() const
+{
+  std::vector<std::string> names = m_schema->metadata.get_names();
+  std::vector<std::string> data  = this->get_data_names();
+  names.insert(names.end(),
+               std::make_move_iterator(data.begin()),
+               std::make_move_iterator(data.end()));
+  return names;
+}
+
+std::vector<std::string> summary::get_data_names() const
+{
+  std::vector<std::string> names;
+  if (m_value)
+  {
+    names.emplace_back("value");
+  }
+  if (m_data)
+  {
+    std::vector<std::string> data = m_data->get_names();
+    names.insert(names.end(),
+                 std::make_move_iterator(data.begin()),
+                 std::make_move_iterator(data.end()));
+  }
+  return names;
+}
+
+std::size_t summary::get_size() const
+{
+  return m_schema->metadata.get_size() + (m_value ? 1 : 0) + (m_data ? m_data->get_size() : 0);
+}
+
+void summary::set_value(std::string name, value_type value)
+{
+  if (name == "value")
+  {
+    m_value = std::move(value);
+  }
+  else if (summary_schema::is_metadata_key(name))
+  {
+    m_schema = &summary_registry::get().with_metadata(*m_schema, name, std::move(value));
+  }
+  else
+  {
+    if (!m_data)
+    {
+      m_data = std::make_unique<nvbench::named_values>();
+    }
+    m_data->set_value(std::move(name), std::move(value));
+  }
+}
+
+void summary::set_int64(std::string name, nvbench::int64_t value)
+{
+  this->set_value(std::move(name), value_type{value});
+}
+
+void summary::set_float64(std::string name, nvbench::float64_t value)
+{
+  this->set_value(std::move(name), value_type{value});
+}
+
+void summary::set_string(std::string name, std::string value)
+{
+  this->set_value(std::move(name), value_type{std::move(value)});
+}
+
+nvbench::int64_t summary::get_int64(const std::string &name) const
+try
+{
+  return std::get<nvbench::int64_t>(this->get_value(name));
+}
+catch (std::exception &err)
+{
+  NVBENCH_THROW(std::runtime_error, "Error looking up int64 value `{}`:\n{}", name, err.what());
+}
+
+nvbench::float64_t summary::get_float64(const std::string &name) const
+try
+{
+  return std::get<nvbench::float64_t>(this->get_value(name));
+}
+catch (std::exception &err)
+{
+  NVBENCH_THROW(std::runtime_error, "Error looking up float64 value `{}`:\n{}", name, err.what());
+}
+
+const std::string &summary::get_string(const std::string &name) const
+try
+{
+  return std::get<std::string>(this->get_value(name));
+}
+catch (std::exception &err)
+{
+  NVBENCH_THROW(std::runtime_error, "Error looking up string value `{}`:\n{}", name, err.what());
+}
+
+summary::type summary::get_type(const std::string &name) const
+{
+  return std::visit(
+    []([[maybe_unused]] auto &&arg) {
+      using T = std::decay_t<decltype(arg)>;
+      if constexpr (std::is_same_v<T, nvbench::int64_t>)
+      {
+        return type::int64;
+      }
+      else if constexpr (std::is_same_v<T, nvbench::float64_t>)
+      {
+        return type::float64;
+      }
+      else
+      {
+        static_assert(std::is_same_v<T, std::string>, "Unexpected value type.");
+        return type::string;
+      }
+    },
+    this->get_value(name));
+}
+
+bool summary::has_value(const std::string &name) const
+{
+  if (name == "value")
+  {
+    return m_value.has_value();
+  }
+  if (summary_schema::is_metadata_key(name))
+  {
+    return m_schema->metadata.has_value(name);
+  }
+  return m_data && m_data->has_value(name);
+}
+
+const summary::value_type &summary::get_value(const std::string &name) const
+{
+  if (name == "value")
+  {
+    if (m_value)
+    {
+      return *m_value;
+    }
+  }
+  else if (summary_schema::is_metadata_key(name))
+  {
+    return m_schema->metadata.get_value(name);
+  }
+  else if (m_data)
+  {
+    return m_data->get_value(name);
+  }
+  NVBENCH_THROW(std::runtime_error, "No value with name '{}'.", name);
+}
+
+void summary::remove_value(const std::string &name)
+{
+  if (name == "value")
+  {
+    m_value.reset();
+  }
+  else if (summary_schema::is_metadata_key(name))
+  {
+    if (m_schema->metadata.has_value(name))
+    {
+      m_schema = &summary_registry::get().with_metadata(*m_schema, name, std::nullopt);
+    }
+  }
+  else if (m_data)
+  {
+    m_data->remove_value(name);
+  }
+}
+
+} // namespace nvbench
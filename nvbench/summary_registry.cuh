@@ -0,0 +1,130 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/named_values.cuh>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace nvbench
+{
+
+/**
+ * The tag and metadata shared by all summaries with the same tag, name, hint,
+ * description and hide values.
+ *
+ * Schemas are interned by nvbench::summary_registry and never destroyed, so
+ * summaries refer to them by pointer instead of storing their own copies of
+ * the metadata strings.
+ */
+struct summary_schema
+{
+  /// Identifies the tag. Schemas that only differ in metadata share a tag_id.
+  std::uint32_t tag_id;
+  std::string tag;
+
+  /// Only contains the reserved metadata keys ("name", "hint", "description"
+  /// and "hide"), in that order, each at most once.
+  nvbench::named_values metadata;
+
+  /// True for the keys that are stored in `metadata`.
+  [[nodiscard]] static bool is_metadata_key(std::string_view key);
+};
+
+/**
+ * Singleton that interns summary schemas.
+ *
+ * Benchmarks that record the same summary in every state should intern its
+ * schema once and pass it to `state::add_summary`:
+ *
+ * ```
+ * static const auto &schema =
+ *   nvbench::summary_registry::get().intern("my/time/mean",
+ *                                           "My Time",
+ *                                           "duration",
+ *                                           "Mean of my measurements");
+ * state.add_summary(schema).set_float64("value", mean);
+ * ```
+ *
+ * Setting a metadata key on a summary also goes through the registry, so
+ * metadata should not vary from state to state; per-state values belong in
+ * other keys.
+ *
+ * All members are thread-safe. Returned references stay valid until the
+ * program exits.
+ */
+struct summary_registry
+{
+  /**
+   * @return The singleton summary_registry instance.
+   */
+  [[nodiscard]] static summary_registry &get();
+
+  /**
+   * Returns the schema for `tag` with the given metadata. Empty metadata
+   * strings are omitted from the schema.
+   */
+  [[nodiscard]] const summary_schema &intern(std::string tag,
+                                             std::string name        = {},
+                                             std::string hint        = {},
+                                             std::string description = {},
+                                             std::string hide        = {});
+
+  /**
+   * Returns `schema` with the metadata key `key` set to `value`, or removed if
+   * `value` is `std::nullopt`.
+   *
+   * @throw std::runtime_error if `key` is not a metadata key, or `value` holds
+   * something other than a string.
+   */
+  [[nodiscard]] const summary_schema &
+  with_metadata(const summary_schema &schema,
+                const std::string &key,
+                std::optional<nvbench::named_values::value_type> value);
+
+  /// The tag_id of `tag`, if any schema with that tag has been interned.
+  [[nodiscard]] std::optional<std::uint32_t> find_tag_id(const std::string &tag) const;
+
+  /// Number of distinct schemas interned so far.
+  [[nodiscard]] std::size_t get_size() const;
+
+private:
+  summary_registry()                                    = default;
+  summary_registry(const summary_registry &)            = delete;
+  summary_registry(summary_registry &&)                 = delete;
+  summary_registry &operator=(const summary_registry &) = delete;
+  summary_registry &operator=(summary_registry &&)      = delete;
+
+  [[nodiscard]] const summary_schema &intern_impl(std::string tag,
+                                                  nvbench::named_values metadata);
+
+  mutable std::mutex m_mutex;
+
+  // Keyed by tag and metadata, see `intern_impl`:
+  std::unordered_map<std::string, std::unique_ptr<summary_schema>> m_schemas;
+  std::unordered_map<std::string, std::uint32_t> m_tag_ids;
+};
+
+} // namespace nvbench
@@ -0,0 +1,148 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <nvbench/summary_registry.cuh>
+
+#include <nvbench/detail/throw.cuh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <variant>
+
+namespace
+{
+
+// Metadata keys in the order they are stored in summary_schema::metadata:
+constexpr std::array<std::string_view, 4> metadata_keys{"name", "hint", "description", "hide"};
+
+} // namespace
+
+namespace nvbench
+{
+
+bool summary_schema::is_metadata_key(std::string_view key)
+{
+  return std::find(metadata_keys.cbegin(), metadata_keys.cend(), key) != metadata_keys.cend();
+}
+
+summary_registry &summary_registry::get()
+{
+  static summary_registry the_registry;
+  return the_registry;
+}
+
+const summary_schema &summary_registry::intern(std::string tag,
+                                               std::string name,
+                                               std::string hint,
+                                               std::string description,
+                                               std::string hide)
+{
+  nvbench::named_values metadata;
+  std::array<std::string *, 4> values{&name, &hint, &description, &hide};
+  for (std::size_t i = 0; i < metadata_keys.size(); ++i)
+  {
+    if (!values[i]->empty())
+    {
+      metadata.set_string(std::string{metadata_keys[i]}, std::move(*values[i]));
+    }
+  }
+  return this->intern_impl(std::move(tag), std::move(metadata));
+}
+
+const summary_schema &
+summary_registry::with_metadata(const summary_schema &schema,
+                                const std::string &key,
+                                std::optional<nvbench::named_values::value_type> value)
+{
+  if (!summary_schema::is_metadata_key(key))
+  {
+    NVBENCH_THROW(std::runtime_error, "'{}' is not a summary metadata key.", key);
+  }
+  if (value && !std::holds_alternative<std::string>(*value))
+  {
+    NVBENCH_THROW(std::runtime_error, "Summary metadata '{}' must be a string.", key);
+  }
+
+  // Rebuild in canonical order:
+  nvbench::named_values metadata;
+  for (const auto &metadata_key : metadata_keys)
+  {
+    std::string name{metadata_key};
+    if (name == key)
+    {
+      if (value)
+      {
+        metadata.set_value(std::move(name), std::move(*value));
+      }
+    }
+    else if (schema.metadata.has_value(name))
+    {
+      metadata.set_value(name, schema.metadata.get_value(name));
+    }
+  }
+  return this->intern_impl(schema.tag, std::move(metadata));
+}
+
+std::optional<std::uint32_t> summary_registry::find_tag_id(const std::string &tag) const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  const auto iter = m_tag_ids.find(tag);
+  if (iter == m_tag_ids.cend())
+  {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+
+std::size_t summary_registry::get_size() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_schemas.size();
+}
+
+const summary_schema &summary_registry::intern_impl(std::string tag,
+                                                    nvbench::named_values metadata)
+{
+  // The key is the tag followed by each metadata key/value pair, joined with
+  // ASCII record/unit separators. Metadata is in canonical order and only holds
+  // strings, so equal schemas produce equal keys.
+  fmt::memory_buffer key;
+  fmt::format_to(std::back_inserter(key), "{}", tag);
+  for (const auto &name : metadata.get_names())
+  {
+    fmt::format_to(std::back_inserter(key), "\x1e{}\x1f{}", name, metadata.get_string(name));
+  }
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  auto [iter, inserted] = m_schemas.try_emplace(fmt::to_string(key));
+  if (inserted)
+  {
+    const auto tag_id =
+      m_tag_ids.try_emplace(tag, static_cast<std::uint32_t>(m_tag_ids.size())).first->second;
+    iter->second = std::make_unique<summary_schema>(
+      summary_schema{tag_id, std::move(tag), std::move(metadata)});
+  }
+  return *iter->second;
+}
+
+} // namespace nvbench
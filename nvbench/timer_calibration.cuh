@@ -0,0 +1,62 @@
+// MIT License
+// Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#pragma once
+
+#include <nvbench/types.cuh>
+
+#include <hip/hip_runtime_api.h>
+
+namespace nvbench
+{
+
+/**
+ * Overheads of the timers used by NVBench's measurements, found by timing
+ * empty regions. Durations are medians, in seconds.
+ *
+ * Device calibrations time an empty kernel launcher with the same sequence of
+ * event records and stream synchronizations used by cold measurements. Host
+ * calibrations only time back-to-back `cpu_timer` start/stop calls.
+ *
+ * @sa nvbench::device_manager::get_timer_calibration
+ */
+struct timer_calibration
+{
+  /// Host time reported for an empty timed region.
+  nvbench::float64_t cpu_timer_overhead{};
+
+  /// GPU time reported by `cuda_timer` for an empty region. Zero for host
+  /// calibrations.
+  nvbench::float64_t cuda_timer_overhead{};
+
+  /// Number of samples used for the calibration.
+  nvbench::int64_t sample_size{};
+};
+
+namespace detail
+{
+
+/// Calibrate `cpu_timer` without using any device.
+[[nodiscard]] nvbench::timer_calibration calibrate_host_timers(nvbench::int64_t num_samples);
+
+/// Calibrate `cpu_timer` and `cuda_timer` on a new stream on the current
+/// device.
+[[nodiscard]] nvbench::timer_calibration calibrate_device_timers(nvbench::int64_t num_samples);
+
+} // namespace detail
+} // namespace nvbench
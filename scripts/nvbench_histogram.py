@@ -69,16 +69,25 @@ def extract_size(summary):
     return int(value_data["value"])
 
 
+def extract_dtype(summary):
+    # Files written before JSON version 1.3.0 have no type and are float32:
+    summary_data = summary["data"]
+    value_data = next(filter(lambda v: v["name"] == "type", summary_data), None)
+    if value_data and value_data["value"] == "float64":
+        return "<f8"
+    return "<f4"
+
+
 def parse_samples_meta(filename, state):
     summaries = state["summaries"]
     if not summaries:
-        return None, None
+        return None, None, None
 
     summary = next(filter(lambda s: s["tag"] == "nv/json/bin:nv/cold/sample_times",
                           summaries),
                    None)
     if not summary:
-        return None, None
+        return None, None, None
 
     sample_filename = extract_filename(summary)
 
@@ -87,16 +96,16 @@ def parse_samples_meta(filename, state):
         sample_filename = os.path.join(os.path.dirname(filename), sample_filename)
 
     sample_count = extract_size(summary)
-    return sample_count, sample_filename
+    return sample_count, sample_filename, extract_dtype(summary)
 
 
 def parse_samples(filename, state):
-    sample_count, samples_filename = parse_samples_meta(filename, state)
+    sample_count, samples_filename, dtype = parse_samples_meta(filename, state)
     if not sample_count or not samples_filename:
         return []
 
     with open(samples_filename, "rb") as f:
-        samples = np.fromfile(f, "<f4")
+        samples = np.fromfile(f, dtype)
 
     assert (sample_count == len(samples))
     return samples
@@ -15,7 +15,7 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 # THE SOFTWARE.
 
-file_version = (1, 0, 0)
+file_version = (1, 3, 0)
 
 file_version_string = "{}.{}.{}".format(file_version[0],
                                         file_version[1],
@@ -0,0 +1,146 @@
+#!/usr/bin/env python
+
+# Modifications Copyright (c) 2024 Advanced Micro Devices, Inc.
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+# Merges the JSON outputs of a benchmark executable run with `--shard i/N`
+# into a single file with the same layout as an unsharded run.
+
+import argparse
+import json
+import sys
+
+from nvbench_json import reader
+
+# Options that only select or balance one shard, each followed by a value.
+# They don't apply to the merged run:
+SHARD_OPTIONS = ("--shard", "--shard-costs")
+
+
+def axis_value_index(axis, value):
+    for i, axis_value in enumerate(axis["values"]):
+        if axis["type"] == "int64":
+            if int(value) == axis_value["value"]:
+                return i
+        elif axis["type"] == "float64":
+            if float(value) == axis_value["value"]:
+                return i
+        elif value == axis_value["value"]:
+            return i
+    raise ValueError("Value '{}' not found on axis '{}'.".format(value, axis["name"]))
+
+
+def state_sort_key(bench, state):
+    # Reproduce the order in which states are generated: devices, then type
+    # configs, then the non-type axes with the first declared varying fastest.
+    # Zipped axes form a single dimension at the position of their first axis.
+    device_ids = [device for device in bench["devices"]]
+    device_pos = device_ids.index(state["device"]) if state["device"] in device_ids else 0
+
+    values = {value["name"]: value["value"] for value in state["axis_values"] or []}
+    axes = bench["axes"] or []
+    axes_by_name = {axis["name"]: axis for axis in axes}
+    zip_groups = {name: group for group in bench.get("zipped_axes", []) for name in group}
+
+    dims = []
+    seen = set()
+    for axis in axes:
+        if axis["type"] == "type":
+            continue
+        dim_name = zip_groups.get(axis["name"], [axis["name"]])[0]
+        if dim_name in seen:
+            continue
+        seen.add(dim_name)
+        dims.append(axis_value_index(axes_by_name[dim_name], values[dim_name]))
+
+    return (device_pos, state["type_config_index"], tuple(reversed(dims)))
+
+
+def strip_shard_args(argv):
+    result = []
+    args = iter(argv)
+    for arg in args:
+        if arg in SHARD_OPTIONS:
+            next(args, None)
+        else:
+            result.append(arg)
+    return result
+
+
+def merge(roots):
+    merged = roots[0]
+
+    # Devices:
+    devices = {device["id"]: device for root in roots for device in root["devices"]}
+    merged["devices"] = [devices[device_id] for device_id in sorted(devices)]
+
+    # Metadata:
+    if merged["meta"].get("argv"):
+        merged["meta"]["argv"] = strip_shard_args(merged["meta"]["argv"])
+    if "streams_created" in merged["meta"]:
+        merged["meta"]["streams_created"] = sum(
+            root["meta"].get("streams_created", 0) for root in roots)
+
+    # Benchmarks, keyed by name:
+    benchmarks = {}
+    for root in roots:
+        for bench in root["benchmarks"]:
+            name = bench["name"]
+            if name not in benchmarks:
+                benchmarks[name] = dict(bench, states=[])
+            # Shards without any states for a benchmark write null:
+            benchmarks[name]["states"].extend(bench["states"] or [])
+
+    for bench in benchmarks.values():
+        bench["states"].sort(key=lambda state: state_sort_key(bench, state))
+        keys = [state_sort_key(bench, state) for state in bench["states"]]
+        for prev, cur in zip(keys, keys[1:]):
+            if prev == cur:
+                raise ValueError("Benchmark '{}' has duplicate states; were the same "
+                                 "shards merged twice?".format(bench["name"]))
+        if not bench["states"]:
+            bench["states"] = None
+
+    merged["benchmarks"] = sorted(benchmarks.values(), key=lambda bench: bench["index"])
+    return merged
+
+
+def main():
+    help_text = "%(prog)s -o merged.json shard0.json shard1.json ..."
+    parser = argparse.ArgumentParser(prog='nvbench_merge', usage=help_text)
+    parser.add_argument('-o', '--output', required=True,
+                        help='Path of the merged JSON file.')
+    parser.add_argument('files', nargs='+',
+                        help='JSON files written by each --shard.')
+    args = parser.parse_args()
+
+    roots = [reader.read_file(filename) for filename in args.files]
+    versions = {root["meta"]["version"]["json"]["string"] for root in roots}
+    if len(versions) != 1:
+        print("ERROR: Cannot merge files with different JSON versions: {}".format(
+            ", ".join(sorted(versions))))
+        return 1
+
+    merged = merge(roots)
+    # Like the benchmark's own JSON output, strings are written unescaped:
+    with open(args.output, "w", encoding="utf-8") as f:
+        json.dump(merged, f, indent=2, ensure_ascii=False)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())